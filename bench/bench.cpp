@@ -0,0 +1,117 @@
+/* bench.cpp
+* 2022-06-21
+* Collin Abraham
+*
+* Rough startup and throughput numbers for the heavier pieces of the cpp20learning module
+* Pass a scale as the first argument to grow/shrink every input (default 1 = a few million items each)
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+import cpp20learning;
+
+using namespace std;
+using namespace cpp20learning;
+
+/* runs work once and prints how long it took, plus items/s when there's a count */
+template<typename FUNC>
+void measure(string_view name, size_t items, FUNC work) {
+	const auto start{ chrono::steady_clock::now() };
+	work();
+	const chrono::duration<double, milli> elapsed{ chrono::steady_clock::now() - start };
+
+	cout << name << ": " << elapsed.count() << " ms";
+	if (items > 0) { cout << ", " << static_cast<size_t>(items / (elapsed.count() / 1000.0)) << " items/s"; }
+	cout << '\n';
+}
+
+int main(int argc, char* argv[]) {
+	const size_t scale{ argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 1 };
+
+	// startup: what it costs to get the shared machinery ready before any work happens
+	measure("startup: thread pool", 0, [] { ThreadPool pool; });
+	measure("startup: seeded string interner", 0, [] { StringInterner names; });
+
+	// radix sort vs the comparison sort on the same records
+	struct Record {
+		int group;
+		unsigned id;
+		auto operator<=>(const Record&) const = default;
+		auto sort_members() const { return tie(group, id); }
+	};
+	vector<Record> records(4'000'000 * scale);
+	for (size_t i{ 0 }; i < records.size(); ++i) {
+		records[i] = { static_cast<int>((i * 2654435761u) % 1000) - 500, static_cast<unsigned>(i * 40503u) };
+	}
+	auto sortedCopy{ records };
+	measure("ranges::sort", records.size(), [&] { ranges::sort(sortedCopy); });
+	measure("radix_sort", records.size(), [&] { radix_sort(records); });
+	if (records != sortedCopy) { cout << "radix_sort disagrees with ranges::sort!\n"; }
+
+	// walking the same view pipeline ten times, recomputed every pass vs cached after the first
+	vector<int> numbers(1'000'000 * scale);
+	for (size_t i{ 0 }; i < numbers.size(); ++i) { numbers[i] = static_cast<int>(i); }
+	auto asText{ numbers | views::reverse | views::transform([](int x) { return to_string(x); }) };
+	auto cachedText{ asText | cached_views::cache_all };
+	size_t textBytes{ 0 };
+	measure("view pipeline x10", numbers.size() * 10, [&] {
+		for (int pass{ 0 }; pass < 10; ++pass) { for (const auto& x : asText) { textBytes += x.size(); } }
+	});
+	measure("cached_views::cache_all x10", numbers.size() * 10, [&] {
+		for (int pass{ 0 }; pass < 10; ++pass) { for (const auto& x : cachedText) { textBytes += x.size(); } }
+	});
+
+	// splitting records straight out of memory
+	string text;
+	for (size_t i{ 0 }; i < 2'000'000 * scale; ++i) { text += "a log line with a few words " + to_string(i) + '\n'; }
+	size_t lineCount{ 0 };
+	measure("record_views::lines", 2'000'000 * scale, [&] {
+		for (const auto line : string_view{ text } | record_views::lines) { lineCount += !line.empty(); }
+	});
+
+	// a four stage pipeline on the pool
+	{
+		ThreadPool pool;
+		Pipeline pipeline{ pool };
+		auto& parsed{ pipeline.channel<long long>(1024) };
+		auto& enriched{ pipeline.channel<long long>(1024) };
+		long long sum{ 0 };
+		const auto items{ 1'000'000 * scale };
+		pipeline.source("parse", views::iota(0LL, static_cast<long long>(items)), parsed);
+		pipeline.transform("enrich", parsed, enriched, [](long long x) { return x * 3; });
+		pipeline.sink("write", enriched, [&sum](long long x) { sum += x; });
+		measure("coroutine pipeline", items, [&] { pipeline.run(); });
+		for (const auto& stage : pipeline.stats()) {
+			cout << "  stage " << stage.name << ": " << static_cast<size_t>(stage.items_per_second()) << " items/s\n";
+		}
+	}
+
+	// deduplicating and pruning a big vector in one pass each
+	vector<int> repeated(10'000'000 * scale);
+	for (size_t i{ 0 }; i < repeated.size(); ++i) { repeated[i] = static_cast<int>((i * 2654435761u) % 1'000'000); }
+	vector<int> doomed;
+	for (int i{ 0 }; i < 100'000; ++i) { doomed.push_back(i * 10); }
+	auto pruned{ repeated };
+	size_t removedCount{ 0 };
+	measure("erase_values (100k values)", pruned.size(), [&] { removedCount += erase_values(pruned, doomed); });
+	measure("unique_by_hash", repeated.size(), [&] { removedCount += unique_by_hash(repeated); });
+
+	// interning a small set of names over and over, the common case
+	StringInterner names;
+	vector<string> pool;
+	for (int i{ 0 }; i < 4'000; ++i) { pool.push_back("name_" + to_string(i)); }
+	size_t idSum{ 0 };
+	measure("StringInterner::intern", 4'000'000 * scale, [&] {
+		for (size_t i{ 0 }; i < 4'000'000 * scale; ++i) { idSum += names.intern(pool[i % pool.size()]).id; }
+	});
+
+	cout << "checksum: " << lineCount + idSum + textBytes + removedCount << '\n';	// using the results keeps the work from being optimised away
+	return 0;
+}
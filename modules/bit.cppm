@@ -0,0 +1,42 @@
+/* bit.cppm
+* 2022-06-21
+* Collin Abraham
+*
+* Partition cpp20learning:bit - the <bit> helpers
+*/
+
+module;
+
+#include <bit>
+#include <bitset>
+#include <cstdint>
+#include <iostream>
+
+export module cpp20learning:bit;
+
+using namespace std;
+
+namespace cpp20learning {
+	/* cpp20 <bit>
+	* global non-member functions that operate on bits
+	* to rotate bits, use: rotl(), rotr()   
+	* to count bits, use: 
+	*	countl_zero()		number of consecutive 0 bits starting at most significant 
+	*	countl_one()		number of consecutive 1 bits starting at most significant
+	*	countr_zero()		number of consecutive 0 bits starting at least significant
+	*	countr_one()		number of consecutive 1 bits starting at least significant
+	*	popcount()			number of 1 bits
+	*/
+
+	export void bit_example() {
+		const uint8_t num = 0b00111010;
+
+		cout << "\nRotate " << bitset<8>(num) << " left by 2 " << bitset<8>(rotl(num,2)) << '\n';
+		cout << "Rotate " << bitset<8>(num) << " left by 3 " << bitset<8>(rotl(num, 3)) << '\n';
+		cout << "Rotate " << bitset<8>(num) << " left by 4 " << bitset<8>(rotl(num, 2)) << '\n';
+		cout << "Rotate " << bitset<8>(num) << " left by -1 " << bitset<8>(rotl(num, -1)) << '\n';
+		cout << "Num of 0 bits after most significant: " << countl_zero(num) << '\n';
+		cout << "Num of 1 bits after most significant: " << countl_one(num) << '\n';
+		cout << "Num of 1 bits: " << popcount(num) << '\n';
+	}
+}
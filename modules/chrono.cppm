@@ -0,0 +1,98 @@
+/* chrono.cppm
+* 2022-06-21
+* Collin Abraham
+*
+* Partition cpp20learning:chrono - calendars, new clocks and time zones
+*/
+
+module;
+
+#include <chrono>
+#include <iostream>
+#include <ratio>
+#include <version>
+
+export module cpp20learning:chrono;
+
+using namespace std;
+
+namespace cpp20learning {
+	/* cpp20 calendars & timezones 
+	* <chrono> extended to support calendars
+	* Gregorian is now supported
+	* 
+	* The following code explores the various new functionalities of the <chrono> library, placing their data into lambdas
+	* and printing the results at the end (overloaded << operator allows stream insertion) 
+	*/
+
+	export void chrono_examples() {
+		// construct a year, 2 ways
+		auto a { chrono::year { 2022 } };
+		auto b { 2022y };
+
+		// construct a month, 2 ways
+		auto c { chrono::month { 06 } };
+		auto d { chrono::June };
+
+		// construct a full date as a std::chrono::year_month_day 
+		auto e { 2022y / chrono::June / 27d };
+
+		// construct a full day using the 2nd Tuesday of July 2022, for ex
+		auto f { chrono::Tuesday[2] / chrono::July / 2022 };
+
+		// <chrono> added support for days, weeks, months, years type alias.. pre-cpp20 seconds, minutes, hours 
+		using days = chrono::duration<int, ratio_multiply<ratio<24>, chrono::hours::period >> ;
+		using weeks = chrono::duration<int, ratio_multiply<ratio<7>, chrono::days::period>>; 
+		using months = chrono::duration<int, ratio_multiply<ratio<4>, chrono::weeks::period>>; // assuming a month is always 4 weeks 
+		using years = chrono::duration<int, ratio_multiply<ratio<12>, chrono::months::period>>;
+
+		weeks w{ 1 }; // constructs 1 week
+		days d1 { w }; // convert one week into days
+		months m1 { 2 }; // constructs 2 months 
+		days d2{ m1 }; // convert 2 months into days (will return 8 weeks, which translates to 7 days/week * 4 weeks/month * 2 = 56 
+
+		// 4 new clocks that can be used 
+		// the clocks and time zones are the last pieces of <chrono> to land in GCC/Clang's standard libraries,
+		// __cpp_lib_chrono only reaches 201907 once they're there
+#if __cpp_lib_chrono >= 201907L
+		auto g = chrono::utc_clock(); // coordinated universal time, measures time since jan 1st 1970, including leap seconds
+		auto h = chrono::tai_clock(); // international atomic time (TAI) measures time since jan 1st 1958 .. offset 10 seconds ahead of UTC without leap seconds
+		auto i = chrono::gps_clock(); // global positioning system time, measure time since jan 1st 1980, without leap seconds
+#endif
+		auto j = chrono::file_clock(); // alias for std::filesystem::file_time_type, unspecific epoch 
+
+		// new type alias sys_time which is a chrono::time_point of a chrono::system_clock within a chorno::duration 
+		using sys_sec = chrono::sys_time<chrono::seconds>;
+		using sys_days = chrono::sys_time<chrono::days>;
+
+		chrono::system_clock::time_point t { sys_days { 2022y / chrono::June / 27d} }; // returns a conversion from date -> time_point
+		auto k { chrono::year_month_day { floor<chrono::days>(t) } }; // returns a converson from time_point -> date
+
+		// date and time can be combined painlessly
+		auto l { sys_days{2022y / chrono::June / 27d} + 10h + 50min + 15s }; // 2022-06-27 10:50:15 UTC time 
+
+#if __cpp_lib_chrono >= 201907L
+		// timezone conversions 
+		chrono::zoned_time local_denver { "America/Denver", l }; // conv the previous sys_days lambda to Miami timezone 
+
+		// what is my current local time?
+		auto m{ chrono::zoned_time { chrono::current_zone(), chrono::system_clock::now() } };
+#endif
+
+		// Ok.. let's output some of these times, they are designed to be able to use the regular stream insertion operator 
+		cout << "\n\n<chrono> changes and timezones: \n";
+		cout << "------------------------------\n";
+		cout << a << endl;
+		cout << b << endl;
+		cout << c << endl;
+		cout << d << endl;
+		cout << e << endl;
+		cout << f << endl;
+		cout << k << endl;
+		cout << l << endl;
+#if __cpp_lib_chrono >= 201907L
+		cout << m << endl;
+#endif
+		cout << "------------------------------\n";
+	}
+}
@@ -0,0 +1,460 @@
+/* containers.cppm
+* 2022-06-21
+* Collin Abraham
+*
+* Partition cpp20learning:containers - <span>, the new container/algorithm helpers, hash based bulk erase/unique and string interning
+*/
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+export module cpp20learning:containers;
+
+import :language;
+
+using namespace std;
+
+namespace cpp20learning {
+	/* cpp20 <span>
+	* view over some contiguous data, does not own the data
+	* no allocations/deallocations
+	* can be either read/write
+	* can be dynamic sized (runtime) or fixed sized (compile time)
+	* very cheap to copy, suggested to pass by value (as is the case with string_view)
+	* does not support strides 
+	* 
+	* The following code declares different ways of using spans then
+	* prints them to the screen in an interesting way using ranges 
+	*/
+
+	export void span_example() {
+		char datum[50];
+
+		// following spans are read and write capable 
+		span <char, 50> theSpan{ datum }; // fixed size of 100 chars 
+		span <char> theSpan2{ datum }; // dynamic size of 100 chars 
+
+		// read only span
+		span<const char> theSpanReadonly{ datum }; // declare the <T> as const, don't declare the entire span as const 
+
+		// spans support most of the std::algorithm uses
+		auto spanBeg = theSpan.begin();
+		auto spanfront = theSpan.front();
+		auto spanEmpty = theSpan.empty();
+		auto spanSize = theSpan.size();
+
+		// fill the array with increasing chars starting at 'a' using writeable span
+		iota(begin(theSpan), end(theSpan), 'a'); 
+
+		// read the array using read-only span.. both are accessing the same data stored 
+		// output results with one increasing char per line at a max column width of 30
+		const auto colsize { 30 };
+		const auto rowsize { theSpanReadonly.size() - colsize + 1};
+
+		cout << endl << "Span output: " << endl;
+		for (auto offset{ 0 }; offset < rowsize; ++offset) {
+			ranges::for_each(theSpanReadonly.subspan(offset, colsize), putchar);
+			putchar('\n');
+		}	
+	}
+
+	/* string interning
+	* "bob" in Something, theStrings in constexpr_example() (both in cpp20learning:language) and the map in
+	* new_std_features() each hold their own copy of short strings that repeat over and over
+	* an interner keeps exactly one copy of every distinct string and hands out a 32 bit InternedString handle for it
+	*	comparing two handles is a single integer compare (the defaulted <=> again)
+	*	the characters live in arena chunks that never move, so view() returns a string_view that stays valid
+	*	the strings are split across shards by hash, each with its own shared_mutex, so threads interning
+	*	different strings rarely wait on each other and lookups of known strings only take a shared lock
+	*	handle -> string_view is a lock free read from a segmented table, segments double in size as ids run out
+	* names known up front can be pre-seeded, they get the first ids .. the default constinit table points straight at
+	* its literals, any other seed list is copied into the arena since its views may point into runtime strings
+	* id 0 is never handed out, so a default InternedString{} means "no name" and views as ""
+	*/
+
+	export struct InternedString {
+		uint32_t id{ 0 };
+		auto operator<=>(const InternedString&) const = default;
+		explicit operator bool() const { return id != 0; }
+	};
+
+	export inline constinit const array<string_view, 6> seededNames{ "bob", "Billy", "Jimmy", "bobs", "sallys", "jimmys" };
+
+	export class StringInterner {
+		static constexpr size_t shardCount{ 16 };
+		static constexpr size_t arenaChunkBytes{ 64 * 1024 };
+		static constexpr uint32_t firstSegmentBits{ 10 };	// 1024 handles, every segment after that doubles
+		static constexpr size_t segmentCount{ 33 - firstSegmentBits };	// enough doublings to cover every 32 bit id
+
+		struct Shard {
+			mutable shared_mutex lock;
+			unordered_map<string_view, uint32_t> ids;
+			vector<unique_ptr<char[]>> chunks;
+			char* current{ nullptr };
+			size_t currentUsed{ arenaChunkBytes };
+
+			/* copy the characters into the arena, long strings get a chunk of their own */
+			string_view store(string_view text) {
+				if (text.empty()) { return {}; }	// nothing to copy, and current may not point at a chunk yet
+
+				char* destination{ nullptr };
+				if (text.size() > arenaChunkBytes / 4) {
+					destination = chunks.emplace_back(make_unique_for_overwrite<char[]>(text.size())).get();
+				}
+				else {
+					if (currentUsed + text.size() > arenaChunkBytes) {
+						current = chunks.emplace_back(make_unique_for_overwrite<char[]>(arenaChunkBytes)).get();
+						currentUsed = 0;
+					}
+					destination = current + exchange(currentUsed, currentUsed + text.size());
+				}
+				ranges::copy(text, destination);
+				return { destination, text.size() };
+			}
+		};
+
+		array<Shard, shardCount> shards;
+		array<atomic<string_view*>, segmentCount> segments{};
+		atomic<uint32_t> nextId{ 1 };	// 0 is the empty handle
+
+		static size_t shard_of(string_view text) { return hash<string_view>{}(text) % shardCount; }
+
+		/* segment k holds 1024 << k handles starting at id 1024 * (2^k - 1), so a handful of names costs one small segment */
+		static pair<size_t, size_t> slot_of(uint32_t id) {
+			const auto shifted{ uint64_t{ id } + (uint64_t{ 1 } << firstSegmentBits) };
+			const auto segment{ static_cast<size_t>(bit_width(shifted >> firstSegmentBits) - 1) };
+			return { segment, static_cast<size_t>(shifted - (uint64_t{ 1 } << (firstSegmentBits + segment))) };
+		}
+
+		void publish(uint32_t id, string_view text) {
+			const auto [index, offset] { slot_of(id) };
+			auto& segment{ segments[index] };
+			auto* slots{ segment.load(memory_order_acquire) };
+			if (!slots) {
+				auto* created{ new string_view[size_t(1) << (firstSegmentBits + index)] };
+				if (segment.compare_exchange_strong(slots, created, memory_order_acq_rel)) { slots = created; }
+				else { delete[] created; }	// another thread got there first, slots now holds theirs
+			}
+			slots[offset] = text;
+		}
+
+		/* the last 32 bit id is never handed out, so nextId can't wrap around onto the empty handle */
+		uint32_t next_id() {
+			auto id{ nextId.load() };
+			do {
+				if (id == numeric_limits<uint32_t>::max()) { throw length_error{ "StringInterner ran out of 32 bit handles" }; }
+			} while (!nextId.compare_exchange_weak(id, id + 1));
+			return id;
+		}
+
+		void seed(span<const string_view> seeds, bool copy) {
+			publish(0, {});
+			for (const auto seed : seeds) {
+				auto& shard{ shards[shard_of(seed)] };
+				if (shard.ids.contains(seed)) { continue; }
+				const auto id{ next_id() };
+				const auto stored{ copy ? shard.store(seed) : seed };
+				publish(id, stored);
+				shard.ids.emplace(stored, id);
+			}
+		}
+
+	public:
+		/* seededNames is constinit over literals, they outlive the interner so no copy is needed */
+		StringInterner() { seed(seededNames, false); }
+		explicit StringInterner(span<const string_view> seeds) { seed(seeds, true); }
+
+		StringInterner(const StringInterner&) = delete;
+		StringInterner& operator=(const StringInterner&) = delete;
+
+		~StringInterner() {
+			for (auto& segment : segments) { delete[] segment.load(); }
+		}
+
+		InternedString intern(string_view text) {
+			auto& shard{ shards[shard_of(text)] };
+			{
+				shared_lock guard{ shard.lock };
+				if (const auto found{ shard.ids.find(text) }; found != shard.ids.end()) { return { found->second }; }
+			}
+
+			scoped_lock guard{ shard.lock };
+			if (const auto found{ shard.ids.find(text) }; found != shard.ids.end()) { return { found->second }; } // raced with another thread
+
+			const auto id{ next_id() };	// before storing, so running out doesn't leave orphaned characters behind
+			const auto stored{ shard.store(text) };
+			publish(id, stored);
+			shard.ids.emplace(stored, id);
+			return { id };
+		}
+
+		optional<InternedString> find(string_view text) const {
+			const auto& shard{ shards[shard_of(text)] };
+			shared_lock guard{ shard.lock };
+			if (const auto found{ shard.ids.find(text) }; found != shard.ids.end()) { return InternedString{ found->second }; }
+			return nullopt;
+		}
+
+		/* only valid for handles that came from this interner */
+		string_view view(InternedString handle) const {
+			const auto [index, offset] { slot_of(handle.id) };
+			return segments[index].load(memory_order_acquire)[offset];
+		}
+
+		size_t size() const { return nextId.load() - 1; }	// distinct strings, not counting the empty handle
+	};
+
+	export void interning_example() {
+		StringInterner names;
+
+		// the same payloads the other examples use, every copy of a name maps to one handle
+		const Something a{ .member = "bob" };
+		const auto bob{ names.intern(a.member) };
+		const string theStrings[] = { "Billy", "Jimmy", "Billy", "bob" };
+
+		vector<jthread> workers;
+		for (int i{ 0 }; i < 4; ++i) {
+			workers.emplace_back([&names, &theStrings] {
+				for (const auto& str : theStrings) { names.intern(str); }
+				names.intern("a name only the threads use");
+			});
+		}
+		workers.clear();	// joins
+
+		cout << "\n\nInterned " << names.size() << " distinct strings, bob is id " << bob.id
+			<< " and compares equal to a fresh intern(\"bob\")? " << (bob == names.intern("bob") ? "true" : "false")
+			<< ", view() gives back: " << names.view(*names.find("a name only the threads use")) << endl;
+	}
+
+	/* hash based bulk kernels for large vectors
+	* new_std_features() below drops values one at a time, erase(find()) or remove() per value is a full pass each,
+	* so pruning m values out of n elements costs n*m .. these do a single pass with a hash set on the side instead
+	*	FlatHashSet: open addressing with linear probing over a power of two table kept under half full,
+	*	the values sit in one flat array of optionals (no node per element like unordered_set)
+	*	erase_values(vec, toRemove) drops every element equal to one of toRemove
+	*	unique_by_hash(vec) keeps the first copy of every value in its original order, std::unique only removes neighbours
+	*	compact_erase_if(vec, pred) is erase_if() as one compacting pass, branch free for trivially copyable types
+	* each returns how many elements were removed, same as erase()/erase_if() do since cpp20
+	* named compact_erase_if so argument dependent lookup never confuses it with std::erase_if
+	*/
+
+	export template<typename T, typename HASH = hash<T>, typename EQUAL = equal_to<T>>
+	class FlatHashSet {
+		vector<optional<T>> slots;	// an empty optional is a free slot, so T needn't be default constructible
+		size_t count{ 0 };
+		int shift{ 64 };	// 64 - log2(capacity)
+		HASH hasher;
+		EQUAL equal;
+
+		/* std::hash is the identity for integers, multiplying by 2^64/phi spreads patterns like multiples of 1024 over the table */
+		size_t slot_of(const T& value) const {
+			return static_cast<size_t>((static_cast<uint64_t>(hasher(value)) * 0x9E3779B97F4A7C15ull) >> shift);
+		}
+
+		void rehash(size_t capacity) {
+			auto old{ exchange(slots, vector<optional<T>>(capacity)) };
+			shift = 64 - countr_zero(capacity);
+			count = 0;
+			for (auto& slot : old) {
+				if (slot) { insert(std::move(*slot)); }
+			}
+		}
+
+	public:
+		/* hash and equal may carry state, unique_by_hash() uses that to key the set on positions in a vector */
+		explicit FlatHashSet(size_t expected = 0, HASH hasher = {}, EQUAL equal = {}) : hasher{ std::move(hasher) }, equal{ std::move(equal) } {
+			rehash(bit_ceil(max<size_t>(expected * 2, 16)));
+		}
+
+		/* true if value wasn't in the set yet */
+		bool insert(T value) {
+			if ((count + 1) * 2 > slots.size()) { rehash(slots.size() * 2); }
+
+			const auto mask{ slots.size() - 1 };
+			for (auto i{ slot_of(value) }; ; i = (i + 1) & mask) {
+				if (!slots[i]) {
+					slots[i].emplace(std::move(value));
+					++count;
+					return true;
+				}
+				if (equal(*slots[i], value)) { return false; }
+			}
+		}
+
+		bool contains(const T& value) const {
+			const auto mask{ slots.size() - 1 };
+			for (auto i{ slot_of(value) }; slots[i]; i = (i + 1) & mask) {
+				if (equal(*slots[i], value)) { return true; }
+			}
+			return false;	// the table is never full, so the probe always reaches an empty slot
+		}
+
+		size_t size() const { return count; }
+	};
+
+	/* pred is called exactly once per element, front to back, so it may keep state (unique_by_hash relies on that) */
+	export template<typename T, typename ALLOC, typename PRED>
+	size_t compact_erase_if(vector<T, ALLOC>& vec, PRED pred) {
+		size_t write{ 0 };
+		if constexpr (is_trivially_copyable_v<T>) {
+			// copy every element and only advance past the keepers, no branch to mispredict on random data
+			for (size_t read{ 0 }; read < vec.size(); ++read) {
+				const bool drop{ static_cast<bool>(pred(as_const(vec[read]))) };
+				vec[write] = vec[read];
+				write += !drop;
+			}
+		}
+		else {
+			for (size_t read{ 0 }; read < vec.size(); ++read) {
+				if (pred(as_const(vec[read]))) { continue; }
+				if (write != read) { vec[write] = std::move(vec[read]); }
+				++write;
+			}
+		}
+
+		const auto removed{ vec.size() - write };
+		vec.erase(vec.begin() + static_cast<ptrdiff_t>(write), vec.end());
+		return removed;
+	}
+
+	/* toRemove is type_identity'd so T comes from the vector alone and arrays/vectors of T convert to the span */
+	export template<typename T, typename ALLOC>
+	size_t erase_values(vector<T, ALLOC>& vec, type_identity_t<span<const T>> toRemove) {
+		if (toRemove.empty()) { return 0; }
+
+		FlatHashSet<T> doomed{ toRemove.size() };
+		for (const auto& value : toRemove) { doomed.insert(value); }
+		return compact_erase_if(vec, [&doomed](const T& value) { return doomed.contains(value); });
+	}
+
+	export template<typename T, typename ALLOC>
+	size_t unique_by_hash(vector<T, ALLOC>& vec) {
+		// the set grows as it goes, sizing for all-distinct up front is mostly empty slots to miss on when values repeat
+		if constexpr (is_trivially_copyable_v<T>) {
+			FlatHashSet<T> seen;
+			return compact_erase_if(vec, [&seen](const T& value) { return !seen.insert(value); });
+		}
+		else {
+			// copying every distinct string into the set would double the peak memory, so the set holds the position of
+			// each first copy instead .. it's filled before anything moves, which keeps those positions valid
+			const auto hashAt{ [&vec](size_t i) { return hash<T>{}(vec[i]); } };
+			const auto equalAt{ [&vec](size_t a, size_t b) { return vec[a] == vec[b]; } };
+			FlatHashSet<size_t, decltype(hashAt), decltype(equalAt)> seen{ 0, hashAt, equalAt };
+
+			vector<bool> repeated(vec.size());
+			for (size_t i{ 0 }; i < vec.size(); ++i) { repeated[i] = !seen.insert(i); }
+
+			size_t position{ 0 };	// compact_erase_if visits every element once, front to back
+			return compact_erase_if(vec, [&repeated, &position](const T&) { return repeated[position++]; });
+		}
+	}
+
+	/* cpp20 soe extra std libary additions
+	* starts_with() and ends_with() for string/string_view
+	* contains() for associative containers 
+	* remove(), remove_if() and unique() for list/forward_list return size_type instead of void
+	* shift_left() and shift_right() added to <algorithm>
+	* erase() and erase_if() added for all containers
+	* midpoint() calculate midpoint of two numbers
+	* lerp() linear interpolation
+	* unsequenced_policy(execution::unseq) algorithm is allowed to be vectorized, but not paralellised 
+	* 
+	* Following code explores each of these features except unsequenced_policy()
+	*/
+
+	/* helper func to print a generic container */
+	export template<typename CONTAINER_TYPE>
+	void printContainer(const CONTAINER_TYPE& cont) {
+		for (const auto& x : cont) { cout << x << " "; };
+	}
+
+	export void new_std_features() {
+		// starts_with()
+		const string str{ "Great balls of fire!" };
+		bool check{ str.starts_with("Gre") };
+		cout << "\n Great balls of fire starts with Gre? " << (check ? "true" : "false") << endl; 
+
+		// contains() 
+		const map newMap{ pair {1,"bobs"}, {2,"sallys"},{3,"jimmys"} };
+		cout << "\nMap contents:\n";
+		for_each(begin(newMap), end(newMap), [](const auto& x) { cout << x.first << " " << x.second << endl; } );
+		bool mapCheck{ newMap.contains(2)};
+		cout << "\nDoes the map contain 2? " << (mapCheck ? "true" : "false") << endl;
+
+		// remove()
+		list<int> newList{ 5,17,54,30,100,7,92 };
+		cout << "\nList contents:\n";
+		printContainer(newList);
+		const auto removeReturn = newList.remove(54);
+		cout << "\nList contents after removing:\n";
+		printContainer(newList);
+		cout << "\nremoveReturn contains: " << removeReturn << endl;
+		// it's the list's own remove() member that returns the size_type count of removed elements..
+		// the free std::remove() from <algorithm> erases nothing, it shuffles the keepers forward and returns an iterator to the new end
+
+		// shift_left()
+		vector<int> aVec{ 5,43,8,23,30,101,44,32 };
+		cout << "\nVector contents: \n";
+		printContainer(aVec);
+		shift_left(begin(aVec), end(aVec), 1);
+		cout << "\nVector contents after shift_left(): \n";
+		printContainer(aVec);
+
+		// erase() 
+		aVec.erase(find(begin(aVec), end(aVec), 101));
+		cout << "\n\nVector contents after calling erase(101): \n";
+		printContainer(aVec);
+
+		// erase_values() drops a whole batch in one pass instead of one erase(find()) per value
+		const auto erased{ erase_values(aVec, array{ 43, 44, 5 }) };
+		cout << "\n\nVector contents after erase_values(43, 44, 5) removed " << erased << ": \n";
+		printContainer(aVec);
+
+		// unique_by_hash() keeps the first of every value, wherever the repeats are
+		vector<int> repeats{ 3,1,3,2,1,3,4 };
+		const auto duplicates{ unique_by_hash(repeats) };
+		cout << "\n\n3 1 3 2 1 3 4 after unique_by_hash() removed " << duplicates << ": \n";
+		printContainer(repeats);
+
+		//midpoint()
+		const int a = 4324324;
+		const int b = 9829342;
+		const auto c = midpoint(a, b);
+		cout << "\n\nMidpoint() between a: " << a << " and b: " << b << " is " << c << endl; 
+
+		//lerp()
+		// from wikipedia: In mathematics, linear interpolation is a method of curve fitting using linear polynomials to construct new data points 
+		// within the range of a discrete set of known data points.
+		// so if a == (1,1) and b == (3,3) ... the linear interpolation between them is the line connecting 1,1 to 3,3 
+		cout << "Linear Interpolation between 5.0 and 10.0 using jumps of 1 : " << endl; 
+		for (auto i{ -5.0 }; i <= 5.0; i += 1)
+			cout << endl << lerp(5.0, 10.0, i);
+	}
+}
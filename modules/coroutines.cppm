@@ -0,0 +1,400 @@
+/* coroutines.cppm
+* 2022-06-21
+* Collin Abraham
+*
+* Partition cpp20learning:coroutines - generators and coroutine pipelines running on a thread pool
+*/
+
+module;
+
+#define _CRT_SECURE_NO_WARNINGS // allow for ctime 
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <ctime>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+export module cpp20learning:coroutines;
+
+import :generator;
+import :language;
+
+using namespace std;
+
+namespace cpp20learning {
+	/* cpp20 - coroutines
+	* Function that contains:
+	*	co_await suspects while waiting for computation to finish
+	*	co_yield returns a value from a coroutine to caller - suspends coroutine
+	*	co_return returns from a co_routine, cannot just use 'return' 
+	* Coroutines simplify asynchronous input/output, even driven apps, generators, lazy computations 
+	* Visual C++ includes some helper clases std::experimental::generator<T>
+	*	that one isn't portable, so the :generator partition has a small generator<T> of our own
+	* 
+	* This function loops returning the system time extracted from chrono::system_clock::now() .. 
+	* uses a coroutine to continually yield execution and wait for use input (cin.ignore())
+	* current i returned to main and waits
+	*/
+	export generator<int> return_seq_generator (const int startVal, const size_t numVals) {	// by value, the body runs long after the call returns
+
+		for (int i{ startVal }; i < startVal + numVals; ++i) {
+			time_t systime { chrono::system_clock::to_time_t(chrono::system_clock::now()) };
+			cout << ctime(&systime);
+			co_yield i;
+		}
+	}
+
+	/* coroutine pipelines
+	* return_seq_generator() hands its values to a single loop in main(), every step runs one after the other
+	* a pipeline splits the work into stages (source -> transform -> filter -> sink) that each run as their own coroutine
+	*	stages are connected by bounded channels, co_await send()/receive() suspend instead of blocking a thread
+	*	a full channel suspends the sender until the stage downstream catches up (backpressure), so memory stays bounded
+	*	suspended stages are resumed on a small thread pool, so parse/enrich/write style stages overlap
+	*	each stage counts the items it handled and how long it ran, giving per-stage throughput
+	* std::latch (see the synchronization notes in cpp20learning:language) lets run() wait until every stage has finished
+	*
+	* closing a channel wakes every waiting stage: receivers drain what is left then get nullopt,
+	* senders get false .. a stage that throws closes both of its channels so the rest of the pipeline winds down
+	*/
+
+	export class ThreadPool {
+		mutex lock;
+		condition_variable_any wake;
+		deque<task<void()>> ready;
+		vector<jthread> workers;	// declared last so the threads stop and join before the queue goes away
+
+		void run(stop_token stop) {
+			while (true) {
+				task<void()> next;
+				{
+					unique_lock guard{ lock };
+					if (!wake.wait(guard, stop, [this] { return !ready.empty(); })) { return; }
+					next = move(ready.front());
+					ready.pop_front();
+				}
+				next();
+			}
+		}
+
+	public:
+		explicit ThreadPool(size_t threads = max(1u, thread::hardware_concurrency())) {
+			for (size_t i{ 0 }; i < threads; ++i) {
+				workers.emplace_back([this](stop_token stop) { run(stop); });
+			}
+		}
+
+		/* coroutine handles are callable too (calling one resumes it), so they post straight in without allocating */
+		void post(task<void()> work) {
+			{
+				scoped_lock guard{ lock };
+				ready.push_back(move(work));
+			}
+			wake.notify_one();
+		}
+
+		/* co_await pool.schedule() continues the coroutine on one of the pool threads */
+		auto schedule() {
+			struct awaiter {
+				ThreadPool& pool;
+				bool await_ready() const noexcept { return false; }
+				void await_suspend(coroutine_handle<> handle) { pool.post(handle); }
+				void await_resume() const noexcept {}
+			};
+			return awaiter{ *this };
+		}
+	};
+
+	export template<typename T>
+	class Channel {
+	public:
+		struct SendAwaiter {
+			Channel& channel;
+			T value;
+			coroutine_handle<> handle{};
+			bool accepted{ true };
+
+			bool await_ready() const noexcept { return false; }
+			bool await_suspend(coroutine_handle<> suspended) {
+				unique_lock guard{ channel.lock };
+				if (channel.closed) { accepted = false; return false; }
+
+				if (!channel.receivers.empty()) {	// hand the value straight to a waiting receiver
+					auto* receiver{ channel.receivers.front() };
+					channel.receivers.pop_front();
+					receiver->slot = move(value);
+					guard.unlock();
+					channel.pool.post(receiver->handle);
+					return false;
+				}
+				if (channel.buffer.size() < channel.capacity) {
+					channel.buffer.push_back(move(value));
+					return false;
+				}
+
+				handle = suspended;	// full, wait until a receiver makes room
+				channel.senders.push_back(this);
+				return true;
+			}
+			bool await_resume() const noexcept { return accepted; }
+		};
+
+		struct ReceiveAwaiter {
+			Channel& channel;
+			optional<T> slot{};
+			coroutine_handle<> handle{};
+
+			bool await_ready() const noexcept { return false; }
+			bool await_suspend(coroutine_handle<> suspended) {
+				unique_lock guard{ channel.lock };
+				SendAwaiter* sender{ nullptr };
+				if (!channel.senders.empty()) {
+					sender = channel.senders.front();
+					channel.senders.pop_front();
+				}
+
+				if (!channel.buffer.empty()) {
+					slot = move(channel.buffer.front());
+					channel.buffer.pop_front();
+					if (sender) { channel.buffer.push_back(move(sender->value)); }	// room for one waiting sender
+				}
+				else if (sender) {
+					slot = move(sender->value);
+				}
+				else if (!channel.closed) {
+					handle = suspended;	// empty, wait for a sender
+					channel.receivers.push_back(this);
+					return true;
+				}
+
+				guard.unlock();
+				if (sender) { channel.pool.post(sender->handle); }
+				return false;
+			}
+			optional<T> await_resume() { return move(slot); }
+		};
+
+		Channel(ThreadPool& pool, size_t capacity) : pool{ pool }, capacity{ capacity } {}
+
+		/* co_await channel.send(value) returns false once the channel is closed */
+		SendAwaiter send(T value) { return { *this, move(value) }; }
+
+		/* co_await channel.receive() returns nullopt once the channel is closed and drained */
+		ReceiveAwaiter receive() { return { *this }; }
+
+		void close() {
+			deque<ReceiveAwaiter*> waitingReceivers;
+			deque<SendAwaiter*> waitingSenders;
+			{
+				scoped_lock guard{ lock };
+				closed = true;
+				waitingReceivers.swap(receivers);
+				waitingSenders.swap(senders);
+			}
+			for (auto* receiver : waitingReceivers) { pool.post(receiver->handle); }
+			for (auto* sender : waitingSenders) {
+				sender->accepted = false;
+				pool.post(sender->handle);
+			}
+		}
+
+	private:
+		ThreadPool& pool;
+		const size_t capacity;
+		mutex lock;
+		deque<T> buffer;
+		deque<SendAwaiter*> senders;
+		deque<ReceiveAwaiter*> receivers;
+		bool closed{ false };
+	};
+
+	export struct StageStats {
+		string name;
+		atomic<size_t> items{ 0 };
+		chrono::steady_clock::time_point started{};
+		chrono::steady_clock::time_point finished{};
+
+		double items_per_second() const {
+			const chrono::duration<double> elapsed{ finished - started };
+			return elapsed.count() > 0 ? items / elapsed.count() : 0.0;
+		}
+	};
+
+	/* the coroutine type every stage returns, starts suspended until Pipeline::run() posts it to the pool */
+	export struct PipelineStage {
+		struct promise_type {
+			latch* done{ nullptr };
+			exception_ptr error{};
+
+			PipelineStage get_return_object() { return PipelineStage{ coroutine_handle<promise_type>::from_promise(*this) }; }
+			suspend_always initial_suspend() noexcept { return {}; }
+			auto final_suspend() noexcept {
+				struct awaiter {
+					bool await_ready() const noexcept { return false; }
+					void await_suspend(coroutine_handle<promise_type> handle) const noexcept { handle.promise().done->count_down(); }
+					void await_resume() const noexcept {}
+				};
+				return awaiter{};
+			}
+			void return_void() {}
+			void unhandled_exception() { error = current_exception(); }
+		};
+
+		coroutine_handle<promise_type> handle;
+
+		explicit PipelineStage(coroutine_handle<promise_type> handle) : handle{ handle } {}
+		PipelineStage(PipelineStage&& other) noexcept : handle{ exchange(other.handle, nullptr) } {}
+		PipelineStage& operator=(PipelineStage&&) = delete;
+		~PipelineStage() { if (handle) { handle.destroy(); } }
+	};
+
+	template<ranges::input_range RANGE, typename T>
+	PipelineStage source_stage(RANGE values, Channel<T>& out, StageStats& stats) {
+		stats.started = chrono::steady_clock::now();
+		try {
+			for (auto&& value : values) {
+				if (!co_await out.send(T(forward<decltype(value)>(value)))) { break; }
+				++stats.items;
+			}
+		}
+		catch (...) { out.close(); throw; }
+		out.close();
+		stats.finished = chrono::steady_clock::now();
+	}
+
+	template<typename IN, typename OUT, typename FUNC>
+	PipelineStage transform_stage(Channel<IN>& in, Channel<OUT>& out, FUNC func, StageStats& stats) {
+		stats.started = chrono::steady_clock::now();
+		try {
+			while (auto item{ co_await in.receive() }) {
+				if (!co_await out.send(invoke(func, move(*item)))) { break; }
+				++stats.items;
+			}
+		}
+		catch (...) { in.close(); out.close(); throw; }
+		in.close();		// tells upstream to stop if we quit early
+		out.close();
+		stats.finished = chrono::steady_clock::now();
+	}
+
+	template<typename T, typename PRED>
+	PipelineStage filter_stage(Channel<T>& in, Channel<T>& out, PRED pred, StageStats& stats) {
+		stats.started = chrono::steady_clock::now();
+		try {
+			while (auto item{ co_await in.receive() }) {
+				++stats.items;
+				if (invoke(pred, as_const(*item)) && !co_await out.send(move(*item))) { break; }
+			}
+		}
+		catch (...) { in.close(); out.close(); throw; }
+		in.close();
+		out.close();
+		stats.finished = chrono::steady_clock::now();
+	}
+
+	template<typename T, typename FUNC>
+	PipelineStage sink_stage(Channel<T>& in, FUNC func, StageStats& stats) {
+		stats.started = chrono::steady_clock::now();
+		try {
+			while (auto item{ co_await in.receive() }) {
+				invoke(func, move(*item));
+				++stats.items;
+			}
+		}
+		catch (...) { in.close(); throw; }
+		stats.finished = chrono::steady_clock::now();
+	}
+
+	/* owns the channels, stages and their stats .. build it up, then run() it once */
+	export class Pipeline {
+		ThreadPool& pool;
+		vector<shared_ptr<void>> channels;
+		deque<StageStats> stageStats;	// deque so the references held by running stages stay put
+		vector<PipelineStage> stages;
+
+		StageStats& add_stats(string_view name) { return stageStats.emplace_back(string{ name }); }
+
+	public:
+		explicit Pipeline(ThreadPool& pool) : pool{ pool } {}
+
+		template<typename T>
+		Channel<T>& channel(size_t capacity) {
+			auto created{ make_shared<Channel<T>>(pool, capacity) };
+			channels.push_back(created);
+			return *created;
+		}
+
+		template<ranges::input_range RANGE, typename T>
+		void source(string_view name, RANGE values, Channel<T>& out) {
+			stages.push_back(source_stage(move(values), out, add_stats(name)));
+		}
+
+		template<typename IN, typename OUT, typename FUNC>
+		void transform(string_view name, Channel<IN>& in, Channel<OUT>& out, FUNC func) {
+			stages.push_back(transform_stage(in, out, move(func), add_stats(name)));
+		}
+
+		template<typename T, typename PRED>
+		void filter(string_view name, Channel<T>& in, Channel<T>& out, PRED pred) {
+			stages.push_back(filter_stage(in, out, move(pred), add_stats(name)));
+		}
+
+		template<typename T, typename FUNC>
+		void sink(string_view name, Channel<T>& in, FUNC func) {
+			stages.push_back(sink_stage(in, move(func), add_stats(name)));
+		}
+
+		/* start every stage on the pool and wait for all of them, rethrows the first stage error */
+		void run() {
+			latch done{ static_cast<ptrdiff_t>(stages.size()) };
+			for (auto& stage : stages) {
+				stage.handle.promise().done = &done;
+				pool.post(stage.handle);
+			}
+			done.wait();
+
+			for (auto& stage : stages) {
+				if (stage.handle.promise().error) { rethrow_exception(stage.handle.promise().error); }
+			}
+		}
+
+		const deque<StageStats>& stats() const { return stageStats; }
+	};
+
+	export void coroutine_pipeline_example() {
+		ThreadPool pool{ 4 };
+		Pipeline pipeline{ pool };
+
+		auto& parsed{ pipeline.channel<int>(256) };
+		auto& enriched{ pipeline.channel<long long>(256) };
+		auto& kept{ pipeline.channel<long long>(256) };
+
+		long long sum{ 0 };
+		pipeline.source("parse", views::iota(1, 100'001), parsed);
+		pipeline.transform("enrich", parsed, enriched, [](int x) { return x * 3LL; });
+		pipeline.filter("even", enriched, kept, [](long long x) { return x % 2 == 0; });
+		pipeline.sink("write", kept, [&sum](long long x) { sum += x; });
+		pipeline.run();
+
+		cout << "\n\nCoroutine pipeline sum: " << sum << '\n';
+		for (const auto& stage : pipeline.stats()) {
+			cout << "  stage " << stage.name << ": " << stage.items << " items, "
+				<< static_cast<size_t>(stage.items_per_second()) << " items/s\n";
+		}
+	}
+}
@@ -0,0 +1,60 @@
+/* format.cppm
+* 2022-06-21
+* Collin Abraham
+*
+* Partition cpp20learning:format - std::format and friends
+*/
+
+module;
+
+#include <format>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+export module cpp20learning:format;
+
+using namespace std;
+
+namespace cpp20learning {
+	/* cpp20 text formatting (std::format)
+	* I/O streams 
+	*	safe + extensible
+	*	hard to read and localize
+	*	no separation of formatting string and args
+	* printf()
+	*	not safe or extensible
+	*	easy to read, no << insertion operators
+	*	separates formating string and args
+	*	easy to localize
+	* 
+	* std::format in cpp20 combines i/o streams and printf()
+	*	easy to read, no need for << 
+	*	safe and extensible
+	*	positional args
+	*	easy to localize
+	*	performs better than sprintf(), ostringstream, to_string()
+	*	no reason to not use it, honestly
+	*/
+
+	export template<typename... Args>
+	string print_dynamically(string_view returnedFrom, Args&&... args) {
+		return std::vformat(returnedFrom, std::make_format_args(args...));
+	}
+
+	export void formatting_example() {
+		cout << format("\n{:=^20}", "A line of text");	// fills empty space with a total of 20 =
+		cout << format("\nRead {0} bytes from {1}\n", 100, "file1.txt"); // if you are reading in file1.txt through a stream
+
+		//also convenient to use with variadic params
+		string formatting = "";
+		int reps = 0;
+		while (reps != 3) {
+			formatting += "{} "; // the formatting string to be used 
+			cout << formatting << " : ";
+			cout << print_dynamically(formatting, "bob", 's', 42, "not used");
+			cout << '\n';
+			++reps;
+		}
+	}
+}
@@ -0,0 +1,84 @@
+/* generator.cppm
+* 2022-06-21
+* Collin Abraham
+*
+* Partition cpp20learning:generator - a small generator<T> coroutine type
+* std::experimental::generator is Visual C++ only and std::generator doesn't arrive until cpp23,
+* so this is the minimum needed to co_yield values into a range-based for loop (or a views pipeline)
+*/
+
+module;
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+export module cpp20learning:generator;
+
+using namespace std;
+
+namespace cpp20learning {
+	export template<typename T>
+	class generator {
+	public:
+		struct promise_type {
+			const T* current{ nullptr };
+			exception_ptr error{};
+
+			generator get_return_object() { return generator{ coroutine_handle<promise_type>::from_promise(*this) }; }
+			suspend_always initial_suspend() const noexcept { return {}; }
+			suspend_always final_suspend() const noexcept { return {}; }
+
+			// the yielded value (or the temporary holding it) lives until the coroutine is resumed
+			suspend_always yield_value(const T& value) noexcept {
+				current = addressof(value);
+				return {};
+			}
+			void return_void() const noexcept {}
+			void unhandled_exception() { error = current_exception(); }
+		};
+
+		class iterator {
+			coroutine_handle<promise_type> coroutine{};
+
+		public:
+			using value_type = T;
+			using difference_type = ptrdiff_t;
+
+			iterator() = default;
+			explicit iterator(coroutine_handle<promise_type> coroutine) : coroutine{ coroutine } {}
+
+			const T& operator*() const { return *coroutine.promise().current; }
+			iterator& operator++() { resume(coroutine); return *this; }
+			void operator++(int) { ++*this; }
+
+			bool operator==(default_sentinel_t) const { return !coroutine || coroutine.done(); }
+		};
+
+		explicit generator(coroutine_handle<promise_type> coroutine) : coroutine{ coroutine } {}
+		generator(generator&& other) noexcept : coroutine{ exchange(other.coroutine, nullptr) } {}
+		generator& operator=(generator&& other) noexcept {
+			swap(coroutine, other.coroutine);
+			return *this;
+		}
+		~generator() { if (coroutine) { coroutine.destroy(); } }
+
+		/* runs the body up to the first co_yield, only call it once */
+		iterator begin() {
+			resume(coroutine);
+			return iterator{ coroutine };
+		}
+		default_sentinel_t end() const noexcept { return {}; }
+
+	private:
+		coroutine_handle<promise_type> coroutine;
+
+		static void resume(coroutine_handle<promise_type> coroutine) {
+			coroutine.resume();
+			if (auto error{ exchange(coroutine.promise().error, nullptr) }) { rethrow_exception(error); }
+		}
+	};
+}
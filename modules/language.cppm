@@ -0,0 +1,903 @@
+/* language.cppm
+* 2022-06-21
+* Collin Abraham
+*
+* Partition cpp20learning:language - the core language changes: concepts, lambdas, constexpr/consteval/constinit,
+* designated init, <=>, using enum and friends, plus the task<> callable and the radix sort built on top of them
+*/
+
+module;
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <numbers>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <version>
+
+// test_macros(): lets use the new features to see if the <optional> library is available
+// #include isn't allowed inside the module itself, so this check lives up here in the global module fragment
+#if __has_include(<optional>)					// does the compiler actually include <optional?>
+	#include <optional>							// if so lets include it 
+	#if __cpp_lib_optional						// check if we are actually defining the optional library 
+		#define has_optional 1					// if we are, then we do have optional
+	#endif
+#elif __has_include(<experimental/optional>)	// maybe we have the experimental/optional header? 
+	#include<experimental/optional>				// if so, add the experimental version and follow same steps as above 
+	#if __cpp_lib_experimental_optional
+		#define has_optional 1
+		#define optional_is_experimental 1
+	#endif
+#endif
+
+export module cpp20learning:language;
+
+using namespace std;
+
+namespace cpp20learning {
+	/* cpp20 - concepts
+	* Predicates evaluated at compile time that constrain template parameters  
+	* Several ways to implement a concept demonstrated below
+	* This concept ensures that value can be decremented 
+	* There are many standard concepts built into the language, such as same, derived_from, convertable_to, constructible, sortable, mergable etc...
+	* Concepts Help the compiler produce nicer error messages .. templated error messages can be nightmare inducing 
+	*/
+
+	/* concept 1 */
+	export template<typename T>
+	concept can_decrement = requires(T value) { 
+		value--; 
+		--value; 
+	};
+
+	/* implementation methods of a concept */
+	export template<can_decrement T>
+	void concept_ex1(T type);
+
+	export template<typename T> requires can_decrement<T>
+	void concept_ex2(T type);
+
+	export template<typename T>
+	void concept_ex3(T type) requires can_decrement<T>;
+
+	export void concept_ex4(can_decrement auto type);
+
+	/* concept 2 - size must be convertable to a size_t and cannot exceed size_t(1000) in size */
+	export template<typename T>
+	concept size_check = requires(T & a) {
+		{ a.size() } -> std::convertible_to<std::size_t>;
+		{ a.size() <= size_t(1000) };
+	};
+
+	/* concepts can be combined together */
+	export template <typename T> requires can_decrement<T> && size_check<T>
+	void concept_ex5(T type);
+
+	export template <typename T> 
+	concept combined_concept = can_decrement<T> && size_check<T>;
+	export void concept_ex6(combined_concept auto type);
+
+	/* error message example */
+	export void concept_ex7(can_decrement auto type) { cout << "Do something"; };
+
+	export struct Bar {};
+
+
+
+	/* cpp20 - lambda changes
+	* Pre cpp20 if you captured by value, the lambda would implicitly capture 'this'
+	* you must be explicit, so lambda will look like [=, this] in captures
+	* Support for template lambda expressions
+	*/
+	export void lambda_changes() {
+		/* several options to use templates with lambdas */
+		auto a = [] <typename T> (T val) { return val + 1; };
+		auto b = [] <typename T> (T * val) { return *val * 5; };
+		auto c = [] <typename T, int intVal> (T(&a)[intVal]) { return a + intVal; };
+
+		/* generic lambdas can accept a vector<T> and can deduce T easier than pre cpp20 */
+		auto d = [] <typename T>(const vector<T>&vec) {
+			T x{ }; // do whatever processing you want
+			T::static_function();
+		};
+
+		/* variadic set of parameters to std::forward */
+		auto e = [](auto&& ...args) { return foo(forward<decltype(args)>(args)...); };		// perfect forwarding pre cpp20
+
+		auto f = []<typename ...T>(T&& ... args) { return foo(forward<T>(args)...); };		// simplified forwarding in cpp20
+
+
+	}
+
+	/* lambda pack expansion
+	* 1st auto g [](){} is a simple capture followed by ellipsis: pack expansion
+	* Pre cpp20 this was legal as there was no init within the capture
+	*/
+	export template <class A, class... Args>
+	auto g = [](A a, Args... args) {
+		return[a, args...]{
+			return invoke(a, args...);
+		};
+	};
+
+	/* init capture is now supported .. call move now, for instance
+	* the ellipsis goes in front of the name for a pack: ...args = std::move(args)
+	*/
+	export template <class A, class... Args>
+	auto h = [](A a, Args... args) {
+		return[a = std::move(a), ...args = std::move(args)]() mutable {
+			return invoke(a, args...);
+		};
+	};
+
+	/* move-only callables
+	* std::function has to be copyable, so it can't hold what h() returns once a capture is move-only (unique_ptr etc.)
+	* and it heap allocates as soon as the captures outgrow its small internal buffer
+	* task<R(Args...)> is a move-only wrapper with an inline buffer, 48 bytes unless you ask for a different size
+	*	a callable that fits the buffer and is nothrow movable is stored in place, no allocation at all
+	*	anything bigger spills to a std::pmr::memory_resource .. hand it a pool resource to recycle those blocks
+	* ThreadPool (in cpp20learning:coroutines) runs task<void()> as its unit of work
+	*/
+
+	export template<typename SIGNATURE, size_t INLINE_BYTES = 48>
+	class task;
+
+	template<typename R, typename... Args, size_t INLINE_BYTES>
+	class task<R(Args...), INLINE_BYTES> {
+		static_assert(INLINE_BYTES >= sizeof(void*), "the inline buffer has to be able to hold a spilled pointer");
+
+		struct Operations {
+			R(*call)(void* storage, Args&&... args);
+			void(*relocate)(void* from, void* to) noexcept;	// move into to, destroy what's left in from
+			void(*destroy)(void* storage, pmr::memory_resource* spill) noexcept;
+		};
+
+		template<typename F>
+		static constexpr Operations inlineOperations{
+			[](void* storage, Args&&... args) -> R { return invoke(*static_cast<F*>(storage), forward<Args>(args)...); },
+			[](void* from, void* to) noexcept {
+				auto* source{ static_cast<F*>(from) };
+				new (to) F(move(*source));
+				source->~F();
+			},
+			[](void* storage, pmr::memory_resource*) noexcept { static_cast<F*>(storage)->~F(); }
+		};
+
+		template<typename F>
+		static constexpr Operations spilledOperations{
+			[](void* storage, Args&&... args) -> R { return invoke(**static_cast<F**>(storage), forward<Args>(args)...); },
+			[](void* from, void* to) noexcept { new (to) F* { *static_cast<F**>(from) }; },
+			[](void* storage, pmr::memory_resource* spill) noexcept {
+				F* callable{ *static_cast<F**>(storage) };
+				callable->~F();
+				spill->deallocate(callable, sizeof(F), alignof(F));
+			}
+		};
+
+		alignas(max_align_t) byte storage[INLINE_BYTES];
+		const Operations* operations{ nullptr };
+		pmr::memory_resource* spill{ nullptr };
+
+	public:
+		template<typename F>
+		static constexpr bool fits_inline{ sizeof(F) <= INLINE_BYTES && alignof(F) <= alignof(max_align_t) && is_nothrow_move_constructible_v<F> };
+
+		task() = default;
+
+		template<typename F> requires (!is_same_v<remove_cvref_t<F>, task> && is_invocable_r_v<R, decay_t<F>&, Args...>)
+		task(F&& callable, pmr::memory_resource* spillResource = pmr::get_default_resource()) {
+			using FUNC = decay_t<F>;
+			if constexpr (fits_inline<FUNC>) {
+				new (storage) FUNC(forward<F>(callable));
+				operations = &inlineOperations<FUNC>;
+			}
+			else {
+				void* memory{ spillResource->allocate(sizeof(FUNC), alignof(FUNC)) };
+				try { new (storage) FUNC* { new (memory) FUNC(forward<F>(callable)) }; }
+				catch (...) {
+					spillResource->deallocate(memory, sizeof(FUNC), alignof(FUNC));
+					throw;
+				}
+				spill = spillResource;
+				operations = &spilledOperations<FUNC>;
+			}
+		}
+
+		task(task&& other) noexcept : operations{ exchange(other.operations, nullptr) }, spill{ other.spill } {
+			if (operations) { operations->relocate(other.storage, storage); }
+		}
+
+		task& operator=(task&& other) noexcept {
+			if (this != &other) {
+				reset();
+				operations = exchange(other.operations, nullptr);
+				spill = other.spill;
+				if (operations) { operations->relocate(other.storage, storage); }
+			}
+			return *this;
+		}
+
+		~task() { reset(); }
+
+		void reset() noexcept {
+			if (operations) { exchange(operations, nullptr)->destroy(storage, spill); }
+		}
+
+		explicit operator bool() const noexcept { return operations != nullptr; }
+		bool allocated() const noexcept { return spill != nullptr && operations != nullptr; }
+
+		R operator()(Args... args) { return operations->call(storage, forward<Args>(args)...); }
+	};
+
+	export void task_example() {
+		// a move-only capture, std::function<int()> would refuse to hold this
+		auto owned{ make_unique<int>(41) };
+		task<int()> small{ [value = move(owned)] { return *value + 1; } };
+
+		// captures bigger than the inline buffer spill, recycled through a pool instead of new/delete
+		pmr::unsynchronized_pool_resource pool;
+		array<int, 32> lookup{};
+		iota(begin(lookup), end(lookup), 0);
+		task<int(size_t)> big{ [lookup](size_t i) { return lookup[i]; }, &pool };
+
+		cout << "\n\ntask results: " << small() << " (allocated? " << (small.allocated() ? "true" : "false") << "), "
+			<< big(31) << " (allocated? " << (big.allocated() ? "true" : "false") << ")\n";
+	}
+
+
+	/* cpp 20 constexpr changes 
+	* Virtual polymorphic functions can be constexpr
+	* can use dynamic_cast() and typeid
+	* do dynamic memory allocations, must remember to explicitly use new/delete (be careful)
+	* can now contain try/catch - but doesn't throw exceptions 
+	* std::string and std::vector are now constexpr support 
+	*
+	*/
+
+	export constexpr size_t constexpr_example() {
+		const string theStrings[] = { "Billy", "Jimmy" };
+		vector<string> vec;
+		for (const auto& str : theStrings) { vec.push_back(str); };
+		return vec.size();
+	}
+
+	/* cpp20 concurrency changes
+	* shared_ptr is thread safe.. guarantees obj is deallocated exactly once
+	* BUT accessing the pointer is not thread safe.. one pointer might be reading ptr and the other may be storing a new ptr
+	* can manually use a mutex to protect access to smart ptr 
+	*	can also use global non-member atomic operations .. atomic_load()
+	*	error prone -> very easy to accidentally not use global non-member atomic operations 
+	* atomic<shared_ptr<T>>
+	* 
+	* My experience and knowledge with threads is lacking, so i'm not going to try to tackle understanding the new features
+	* until I get some more experience with concurrency period (soon) 
+	*/
+
+	/* cpp20 synchronization library
+	* <semaphore>
+	*	lightweight synchronization primtiives.. can implement any other sync concept (mutex, latches, barriers)
+	*	couting semaphore models non-negative resource count
+	*	binary semaphore only has 1 slot -> free slow or no free slot which is ideal for a mutex
+	* 
+	* <latch>
+	*	coordination point within a thread 
+	*	thread block at a latch point until a iven number of threads reach the latch point
+	*	at which point all threads are allowed to continue 
+	*	a std::latch is a single use object
+	* 
+	* <barrier>
+	*	a sequence of phases
+	*	number of threads block until req number of threads arrive at a barrier 
+	*		a phase completion callback is executed
+	*		thread counter is reset
+	*		next phase starts
+	*		threads can continue
+	* 
+	* <atomic>
+	*	atomic reference
+	*	operates almost the same as std::atomic but works with references 
+	*	whereas std::atomic always copies the value it is provided
+	* 
+	*/
+
+	export void concurrency_examples() {
+		/* TO-DO:
+		* learn threading and get updated on threading changes
+		*/
+	}
+
+	/* cpp20 designated initializers
+	* aggregates can be designated init 
+	* 
+	* The following code declares a simple class with a string member, then defines a function
+	* which uses designated init to set the member as "bob" right away 
+	*/
+	export struct Something {
+		string member;
+	};
+
+	export void constructSomething() {
+		Something a { .member = "bob" };
+	}
+
+	/* cpp20 three way comparison operator (also known as Spaceship operator)
+	* can compare two objects and then compare the result with 0
+	* similar to the old C-style strcmp() 
+	*	returning -n, 0 or +n 
+	* 
+	* This function creates an int i = 4000, then uses std::strong_ordering::less/greater/equal 
+	* to determine if it's state when compared against the number 0, stored in theResult 
+	*/
+
+	export void spaceship_operator_example() {
+
+		cout << "\n\nSpaceship operator example: ";
+
+		const int i = 4000;
+		strong_ordering theResult{ i <=> 0 };
+
+		if (theResult == strong_ordering::less) { cout << "it's less"; }
+		if (theResult == strong_ordering::greater) { cout << "it's greater"; }
+		if (theResult == strong_ordering::equal) { cout << "it's equal"; }
+	
+		cout << endl;
+	}
+
+	/* <compare> using cpp20 
+	* library heavily simplifies writing operator overloads for classes 
+	* compiler auto generates all six standard comparisons == != > < >= <= 
+	* all standard library types include support: vector, string, map, set etc. 
+	* 
+	* Declare a simple class, auto generate comparison operators <=>
+	* call a function to see if operators work 
+	*/
+	export class CompareClass {
+		int x;
+
+	public:
+		CompareClass(const auto& x) { this->x = x; };
+
+	public:
+		auto operator<=>(const CompareClass&) const = default;
+
+		// members in declaration order, the same order the defaulted <=> compares them (used by radix_sort below)
+		auto sort_members() const { return tie(x); }
+	};
+
+	export void compare_class_example() {
+		CompareClass foo(11);
+		CompareClass bar(10);
+	
+		// lets try out some of the comparison operators (foo > bar)
+		if (foo == bar)
+			cout << "\n\nfoo == bar!\n";
+		else if (foo > bar)
+				cout << "\n\n foo > bar!\n";
+		else if (foo < bar)
+				cout << "\n\n foo < bar!\n";
+		else
+			cout << "\n\n foo != bar!\n";
+	}
+
+	/* radix sorting spaceship ordered records
+	* a defaulted <=> compares the members one by one in declaration order, so sorting with it means a
+	* branchy member-wise comparison for every pair of records (array-of-structs, lots of mispredicts)
+	* the same ordering can be produced without comparisons:
+	*	each member is normalised into an unsigned key that sorts the same way as the member does
+	*	signed ints flip their sign bit, floats flip every bit when negative and only the sign bit otherwise
+	*	each member only keeps the bits its values span (key minus the lowest key), and neighbouring members are packed
+	*	into 64 bit keys, first member in the high bits .. usually the whole record fits one key, and when the record
+	*	index fits in the bits left over it rides along in the same integer
+	*	a stable LSD radix sort per key, last one first, makes the result lexicographic .. same as <=>
+	*	keys and record indices are kept in their own arrays (structure-of-arrays): the records are read in order
+	*	to find the key ranges and pull out the keys, and moved once at the end, the passes in between only touch the keys
+	*
+	* there is no reflection in cpp20, so a record opts in by exposing its members through sort_members()
+	* in the same order they're declared (see CompareClass above)
+	*/
+
+	export template<typename T>
+	concept radix_key = integral<T> || floating_point<T>;
+
+	export template<typename T>
+	concept radix_sortable = three_way_comparable<T> && requires(const T & record) {
+		{ get<0>(record.sort_members()) };
+	};
+
+	export template<radix_key T>
+	constexpr auto normalise_key(T value) {
+		if constexpr (floating_point<T>) {
+			using U = conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+			const U bits{ bit_cast<U>(value) };
+			constexpr U signBit{ U(1) << (sizeof(U) * 8 - 1) };
+			return (bits & signBit) ? U(~bits) : U(bits | signBit);
+		}
+		else {
+			using U = make_unsigned_t<conditional_t<is_same_v<T, bool>, unsigned char, T>>;
+			U bits{ static_cast<U>(value) };
+			if constexpr (signed_integral<T>) { bits ^= U(1) << (sizeof(U) * 8 - 1); }
+			return bits;
+		}
+	}
+
+	/* 11 bit digits: a pass's 2048 counters still fit in L1, and a 42 bit key takes 4 passes instead of 6 */
+	constexpr unsigned radixDigitBits{ 11 };
+
+	/* one stable LSD radix sort of keys by their bits [firstBit, lastBit), carrying order[] along unless it's empty
+	* every histogram is counted in a single read of the keys up front, and passes where
+	* every key shares the same digit are skipped */
+	template<typename KEY>
+	void radix_sort_keys(vector<KEY>& keys, vector<uint32_t>& order, unsigned firstBit, unsigned lastBit) {
+		constexpr size_t buckets{ size_t(1) << radixDigitBits };
+		const unsigned passes{ (lastBit - firstBit + radixDigitBits - 1) / radixDigitBits };
+
+		vector<array<uint32_t, buckets>> counts(passes);
+		for (const auto key : keys) {
+			for (unsigned pass{ 0 }; pass < passes; ++pass) { ++counts[pass][(key >> (firstBit + pass * radixDigitBits)) & (buckets - 1)]; }
+		}
+
+		vector<KEY> keysScratch(keys.size());
+		vector<uint32_t> orderScratch(order.size());
+
+		for (unsigned pass{ 0 }; pass < passes; ++pass) {
+			auto& offsets{ counts[pass] };
+			if (ranges::find(offsets, keys.size()) != offsets.end()) { continue; } // all in one bucket
+
+			uint32_t offset{ 0 };
+			for (auto& count : offsets) { offset += exchange(count, offset); }
+
+			const auto shift{ firstBit + pass * radixDigitBits };
+			if (order.empty()) {
+				for (const auto key : keys) { keysScratch[offsets[(key >> shift) & (buckets - 1)]++] = key; }
+			}
+			else {
+				for (size_t i{ 0 }; i < keys.size(); ++i) {
+					const auto dest{ offsets[(keys[i] >> shift) & (buckets - 1)]++ };
+					keysScratch[dest] = keys[i];
+					orderScratch[dest] = order[i];
+				}
+				order.swap(orderScratch);
+			}
+			keys.swap(keysScratch);
+		}
+	}
+
+	/* the normalised key type of a record's member I */
+	template<typename MEMBERS, size_t I>
+	using member_key_t = decltype(normalise_key(declval<tuple_element_t<I, MEMBERS>>()));
+
+	export template<radix_sortable T>
+	void radix_sort(vector<T>& records) {
+		// tiny inputs aren't worth the histograms, huge ones don't fit the 32 bit index array
+		// stable like the radix path, so equal records keep their input order at every size
+		if (records.size() < 256 || records.size() > numeric_limits<uint32_t>::max()) {
+			ranges::stable_sort(records);
+			return;
+		}
+
+		using MEMBERS = decltype(declval<const T&>().sort_members());
+		constexpr auto memberCount{ tuple_size_v<MEMBERS> };
+		constexpr auto members{ make_index_sequence<memberCount>{} };
+
+		// first read: the range of every member's key, so each member only takes the bits its values actually span
+		auto lowest{ [] <size_t... I> (index_sequence<I...>) { return tuple{ numeric_limits<member_key_t<MEMBERS, I>>::max()... }; }(members) };
+		decltype(lowest) highest{};
+		for (const auto& record : records) {
+			const auto values{ record.sort_members() };
+			[&] <size_t... I> (index_sequence<I...>) {
+				([&] {
+					const auto key{ normalise_key(get<I>(values)) };
+					get<I>(lowest) = min(get<I>(lowest), key);
+					get<I>(highest) = max(get<I>(highest), key);
+				}(), ...);
+			}(members);
+		}
+		const auto widths{ [&] <size_t... I> (index_sequence<I...>) {
+			return array<unsigned, memberCount>{ static_cast<unsigned>(bit_width(static_cast<member_key_t<MEMBERS, I>>(get<I>(highest) - get<I>(lowest))))... };
+		}(members) };
+
+		// group the members, last first, into chunks whose keys pack into one 64 bit integer each
+		vector<pair<size_t, size_t>> chunks;	// [first, last) members, least significant chunk first
+		vector<unsigned> chunkBits;
+		size_t last{ memberCount };
+		unsigned bits{ 0 };
+		for (size_t member{ memberCount }; member-- > 0;) {
+			if (bits + widths[member] > 64) {
+				chunks.emplace_back(member + 1, exchange(last, member + 1));
+				chunkBits.push_back(exchange(bits, 0u));
+			}
+			bits += widths[member];
+		}
+		chunks.emplace_back(0, last);
+		chunkBits.push_back(bits);
+
+		// the chunk's members minus their lowest values, first member in the most significant bits
+		const auto packed_key{ [&](const T& record, pair<size_t, size_t> chunk) {
+			const auto values{ record.sort_members() };
+			uint64_t packed{ 0 };
+			[&] <size_t... I> (index_sequence<I...>) {
+				([&] {
+					if (I < chunk.first || I >= chunk.second) { return; }
+					packed = (widths[I] < 64 ? packed << widths[I] : 0) | static_cast<uint64_t>(normalise_key(get<I>(values)) - get<I>(lowest));
+				}(), ...);
+			}(members);
+			return packed;
+		} };
+
+		vector<uint32_t> order(records.size());
+		const auto indexBits{ static_cast<unsigned>(bit_width(records.size() - 1)) };
+
+		if (chunks.size() == 1 && chunkBits[0] + indexBits <= 64) {
+			// second read: the key sits above the record's index in one integer, so every pass moves a single array
+			vector<uint64_t> keys(records.size());
+			for (size_t i{ 0 }; i < records.size(); ++i) { keys[i] = packed_key(records[i], chunks[0]) << indexBits | i; }
+			vector<uint32_t> carried;
+			radix_sort_keys(keys, carried, indexBits, indexBits + chunkBits[0]);
+
+			const auto indexMask{ (uint64_t(1) << indexBits) - 1 };
+			for (size_t i{ 0 }; i < keys.size(); ++i) { order[i] = static_cast<uint32_t>(keys[i] & indexMask); }
+		}
+		else {
+			iota(begin(order), end(order), 0u);
+
+			// second read: every chunk's key into its own column
+			vector<vector<uint64_t>> columns(chunks.size(), vector<uint64_t>(records.size()));
+			for (size_t i{ 0 }; i < records.size(); ++i) {
+				for (size_t chunk{ 0 }; chunk < chunks.size(); ++chunk) { columns[chunk][i] = packed_key(records[i], chunks[chunk]); }
+			}
+
+			// least significant chunk first, each sort keeps the order of the previous one for equal keys
+			// and gathers its keys from the chunk's column, never from the records
+			for (size_t chunk{ 0 }; chunk < chunks.size(); ++chunk) {
+				vector<uint64_t> keys;
+				if (chunk == 0) { keys = move(columns[0]); }	// still in record order
+				else {
+					const auto column{ move(columns[chunk]) };	// freed once its sort is done
+					keys.resize(column.size());
+					for (size_t i{ 0 }; i < order.size(); ++i) { keys[i] = column[order[i]]; }
+				}
+				radix_sort_keys(keys, order, 0, chunkBits[chunk]);
+			}
+		}
+
+		// permute the records once, every record is moved exactly one time
+		vector<T> sorted;
+		sorted.reserve(records.size());
+		for (const auto index : order) { sorted.push_back(move(records[index])); }
+		records = move(sorted);
+	}
+
+	export void radix_sort_example() {
+		vector<CompareClass> records;
+		for (int i{ 0 }; i < 10'000; ++i) { records.emplace_back((i * 7919) % 5003 - 2500); }
+
+		radix_sort(records);
+		cout << "\nRadix sorted " << records.size() << " CompareClass records, sorted by <=>? "
+			<< (ranges::is_sorted(records) ? "true" : "false") << endl;
+	}
+
+	/* cpp20 range-based for loop init
+	* 
+	* Declare a simple class with vector<int> as a member, create a function that returns a new obj of that class
+	* call a function that initializes the object within a ranged for loop 
+	*/
+
+	export struct RangedBasedLoopClass { vector<int> member; };
+
+	export RangedBasedLoopClass return_data() { return RangedBasedLoopClass(); }
+
+	export void loop_init_ex() {
+		int i = 10;
+
+		for (auto data{ return_data() }; auto & val : data.member) {
+			/* do something */
+		}
+	}
+
+	/* cpp20 - non-type template parameters 
+	* in the past non-type template param had limitations
+	* could not use string literals...
+	* float is allowed
+	* some class types are allowed 
+	* 
+	* 'auto usecase' gives an example usecase where you can create a compile time regex match with the
+	* CTRE library .. rather than a run-time regex match 
+	*/
+
+	// auto usecase{ ctre::match<"[a-z].+([0-9]+)%">(str) };
+
+
+	/* cpp20 [[likely]] and [[unlikely]]
+	* gives hints to compiler to aid in optimization of conditional branches
+	* 
+	* This simple function declare an int i = 100, passes it into a switch and we tell the compiler that it's likely that it is greater
+	* than or equal to 50 and unlikely to not be >= 50.. optimization
+	*/
+	export void likely_unlikely_example() {
+		const int i = 100;
+
+		switch (i) {
+			[[likely]] case (i >= 50):
+				break;
+			[[unlikely]] case (i < 50):
+				break;
+		}
+	}
+
+	/* cpp20 feature testing macros
+	* does the compiler support language or library features?
+	* 
+	* <version>
+	* implementation dependent information about whatever library you're using 
+	* version number, release date, copywrite notice, implementation-defined info
+	* includes library feature test macros:
+	*	__cpp_lib_filesystem   etc...
+	* 
+	* This function shows some feature testing macros to see how our compiler is handling headers and libraries from the standard 
+	*/
+	export void test_macros() {
+		__cpp_binary_literals;	// support literals?
+		__cpp_char8_t; // support for utf-8 chars?
+		__cpp_lib_coroutine; // support for coroutine library features?
+		__cpp_lib_ranges; // support for ranges? 
+
+		// the <optional> check that used to live here is at the top of this file now, #include isn't allowed inside a module
+	}
+
+	/* cpp20 immediate functions 
+	* constexpr may be called at compile time, but that still isn't necessarily a hard requirement 
+	* 
+	* following code demonstrates the difference between constexpr and consteval 
+	*/
+
+	// --- use constexpr 
+	export constexpr auto yardToCm(double yard) { return yard * 91.44; };
+
+	const double const_yard{ 2 };
+	const auto a{ yardToCm(const_yard) };	// evaluated at compile time
+
+	double dyn_yard{ 5 };
+	const auto b{ yardToCm(dyn_yard) }; // evaluated at run time, but what if that's not what you want?
+
+	// --- use const eval
+	export consteval auto yardToCmEval (double yard) { return yard * 91.44; };	// guarantees that calls to yardToCmEval are executed at compile-time
+
+	constexpr double constexpr_yard{ 2 };
+	const auto c{ yardToCmEval(constexpr_yard) }; // evaluated at compile, everything is constant 
+
+	//const auto d{ yardToCmEval(dyn_yard) };	// impossible sice dyn_yard isn't const, can't be guaranteed at compile time 
+
+	/* cpp20 constinit
+	* allows for guaranteed const initialization values.. 
+	* this helps to avoid bugs as a result of undefined order of dynamic initializations 
+	* can create static variables with const initializers
+	* 
+	* following code demonstrates how constinit checks that the initializaton only occurs
+	* when it is used after calling a constexpr function 
+	*/
+
+	const char* foo() { return "this has dynamic init"; }
+	constexpr const char* bar(bool statement) { return statement ? "const init" : foo(); }
+	constinit const char* foobar = bar(true);
+	//constinit const char* fuubar = bar(false); // impossible because it tries to call the non constexpr foo()
+
+
+	/* cpp20 class enums & using directive 
+	* cpp11 class enums were strongly typed.. annoying 
+	* simplifies using enums 
+	*/
+	export enum class Seasons {Spring, Summer, Fall, Winter};
+
+	// cpp11 had to explicitly declare the parent scope
+	export string_view returnString(const Seasons currentSeason) {
+		switch (currentSeason) {
+			case Seasons::Spring: return "It's Spring!";
+			case Seasons::Summer: return "It's Summer!";
+			case Seasons::Fall: return "It's Fall!";
+			case Seasons::Winter: return "It's Winter!";
+		}
+	}
+
+	// cpp20 using directive.. be careful, use a small scope or you end up
+	// exporting everything again and run into C-style enum issues
+	export string_view returnStringCpp20(const Seasons currentSeason) {
+		switch (currentSeason) {
+			using enum Seasons;
+			case Spring: return "It's Spring!";
+			case Summer: return "It's Summer!";
+			case Fall: return "It's Fall!";
+			case Winter: return "It's Winter!";
+		}
+
+	}
+
+	/* enum <-> string tables generated at compile time
+	* the switches above are written by hand, and going from a string back to the enum needs a chain of ifs or a map
+	* there's no reflection in cpp20, but __PRETTY_FUNCTION__ (__FUNCSIG__ on MSVC) of a template instantiated with
+	* an enumerator spells out the enumerator's name, and a consteval function can pick it apart
+	*	every value from 0 to enumReflectionLimit - 1 is tried, values that aren't enumerators print as a cast like (Seasons)4
+	*	to_string() indexes a table by the underlying value, O(1)
+	*	from_string() uses a perfect hash found at compile time, one hash + one string compare, O(1)
+	*	enum_values<E> is a constexpr array to iterate over the enumerators
+	*
+	* an enum opts in by specializing enable_enum_reflection, only scoped (class) enums with values in [0, limit) are supported
+	*/
+
+	export template<typename E>
+	constexpr bool enable_enum_reflection{ false };
+
+	template<>
+	constexpr bool enable_enum_reflection<Seasons>{ true };
+
+	export template<typename E>
+	concept reflected_enum = is_enum_v<E> && !is_convertible_v<E, underlying_type_t<E>> && enable_enum_reflection<E>;
+
+	export inline constexpr size_t enumReflectionLimit{ 64 };
+
+	template<auto VALUE>
+	consteval string_view enumerator_name() {
+	#if defined(_MSC_VER) && !defined(__clang__)
+		string_view signature{ __FUNCSIG__ };
+		const auto start{ signature.find("enumerator_name<") + 16 };
+		signature = signature.substr(start, signature.rfind(">(void)") - start);
+	#else
+		string_view signature{ __PRETTY_FUNCTION__ };
+		const auto start{ signature.find("VALUE = ") + 8 };
+		signature = signature.substr(start, signature.find_first_of(";]", start) - start);
+	#endif
+		if (signature.starts_with('(')) { return {}; }		// not an enumerator
+		return signature.substr(signature.rfind(':') + 1);	// drop the Seasons:: qualification
+	}
+
+	/* FNV-1a with a seed, the seed is what the perfect hash search varies */
+	export constexpr uint32_t seeded_hash(string_view text, uint32_t seed) {
+		uint32_t hash{ 2166136261u ^ seed };
+		for (const char c : text) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 16777619u;
+		}
+		return hash ^ (hash >> 16);	// the low bits pick the slot, fold the better mixed high bits into them
+	}
+
+	export template<reflected_enum E>
+	class enum_reflection {
+		static constexpr auto namesByValue{ [] <size_t... I> (index_sequence<I...>) {
+			return array<string_view, sizeof...(I)>{ enumerator_name<static_cast<E>(I)>()... };
+		}(make_index_sequence<enumReflectionLimit>{}) };
+		static constexpr size_t count{ static_cast<size_t>(ranges::count_if(namesByValue, [](string_view name) { return !name.empty(); })) };
+		static_assert(count > 0, "no enumerators found in [0, enumReflectionLimit)");
+
+	public:
+		static constexpr auto values{ [] {
+			array<E, count> found{};
+			size_t next{ 0 };
+			for (size_t i{ 0 }; i < namesByValue.size(); ++i) {
+				if (!namesByValue[i].empty()) { found[next++] = static_cast<E>(i); }
+			}
+			return found;
+		}() };
+
+	private:
+		// at least twice as many slots as names keeps the seed search short
+		static constexpr size_t tableSize{ bit_ceil(count * 2) };
+
+		static constexpr uint32_t seed{ [] {
+			for (uint32_t candidate{ 0 }; ; ++candidate) {
+				array<bool, tableSize> used{};
+				bool collision{ false };
+				for (const auto value : values) {
+					const auto slot{ seeded_hash(namesByValue[static_cast<size_t>(value)], candidate) & (tableSize - 1) };
+					collision = collision || exchange(used[slot], true);
+				}
+				if (!collision) { return candidate; }
+			}
+		}() };
+
+		// slot -> 1 + index into values, 0 for an empty slot
+		static constexpr auto table{ [] {
+			array<uint8_t, tableSize> slots{};
+			for (size_t i{ 0 }; i < values.size(); ++i) {
+				slots[seeded_hash(namesByValue[static_cast<size_t>(values[i])], seed) & (tableSize - 1)] = static_cast<uint8_t>(i + 1);
+			}
+			return slots;
+		}() };
+
+	public:
+		static constexpr string_view to_string(E value) {
+			const auto index{ static_cast<size_t>(value) };
+			return index < namesByValue.size() ? namesByValue[index] : string_view{};
+		}
+
+		static constexpr optional<E> from_string(string_view name) {
+			const auto slot{ table[seeded_hash(name, seed) & (tableSize - 1)] };
+			if (slot == 0 || to_string(values[slot - 1]) != name) { return nullopt; }
+			return values[slot - 1];
+		}
+	};
+
+	using std::to_string;	// a to_string in this namespace would otherwise hide the std ones for int, double ..
+
+	export template<reflected_enum E>
+	constexpr string_view to_string(E value) { return enum_reflection<E>::to_string(value); }
+
+	export template<reflected_enum E>
+	constexpr optional<E> from_string(string_view name) { return enum_reflection<E>::from_string(name); }
+
+	export template<reflected_enum E>
+	constexpr auto enum_values{ enum_reflection<E>::values };
+
+	static_assert(to_string(Seasons::Fall) == "Fall");
+	static_assert(from_string<Seasons>("Winter") == Seasons::Winter);
+	static_assert(!from_string<Seasons>("Monsoon"));
+
+	export void enum_reflection_example() {
+		cout << "\n\nSeasons generated at compile time: ";
+		for (const auto season : enum_values<Seasons>) { cout << to_string(season) << " "; }
+
+		const auto parsed{ from_string<Seasons>("Summer") };
+		cout << "\nParsed \"Summer\" back into the enum: " << (parsed ? returnStringCpp20(*parsed) : "no such season") << endl;
+	}
+
+	/* cpp20 <numbers> 
+	* defines many mathematical constants clearly
+	* 
+	* many to choose from, here are a few examples
+	*/
+	export void numbers_example() {
+	
+		const auto a = numbers::e;
+		const auto b = numbers::log2e;
+		const auto c = numbers::pi;
+		const auto d = numbers::sqrt2;
+		const auto e = numbers::phi; 
+
+		// and many more in the std::numbers namespace 
+	}
+
+
+	/* cpp20 <source_location>
+	* represents info about a location within source code.. 
+	*	line, column, file_name, function_name
+	* don't have to use any preproccesor macros anymore
+	* 
+	* The following code returns the file path we're working with and what line we're at for that source_location call
+	*/
+	export void sourcelocation_example() {
+		const source_location& myLocation = source_location::current();
+		cout << "\nCurrent file: " << myLocation.file_name() << " at line#: " << myLocation.line() << endl;
+
+	}
+
+
+	/* cpp20 nodiscard(reason)
+	* was added in cpp11 but now you can give an arbirary reason why the return value
+	* of the function should not be discarded
+	* 
+	* This code returns a raw pointer that needs to be dealt with, else it causes a memory leak
+	* and the nodiscard expains what is going on
+	*/
+
+	export [[nodiscard("Ignoring return value may cause a memory leak")]]
+	int* nodiscard_memoryleak() {
+		int* value = new int(50);
+		return value;
+	}
+}
@@ -0,0 +1,27 @@
+/* module1.cppm
+* 2022-06-21
+* Collin Abraham
+*
+* This is an example module, a new feature included in the cpp20 standard
+* Only get_return_words() is accessible due to export keyword
+*
+* cpp20learning is also split into partitions (the other .cppm files in this folder), one per feature area
+* a partition is only visible outside the module through 'export import' in this primary interface,
+* so a plain 'import cpp20learning;' brings in all of them
+*/
+
+export module cpp20learning;
+
+export import :generator;
+export import :language;
+export import :ranges;
+export import :coroutines;
+export import :chrono;
+export import :format;
+export import :bit;
+export import :containers;
+
+namespace cpp20learning {
+	auto return_words() { return "This string came from a module!"; }
+	export auto get_return_words() { return return_words; }
+}
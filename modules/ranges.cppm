@@ -0,0 +1,409 @@
+/* ranges.cppm
+* 2022-06-21
+* Collin Abraham
+*
+* Partition cpp20learning:ranges - ranges and views, a caching view adaptor, plus memory mapped files as a pipeline source
+*/
+
+module;
+
+#include <algorithm>
+#include <bit>
+#include <coroutine>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define has_mapped_file 1
+#endif
+
+export module cpp20learning:ranges;
+
+import :generator;
+
+using namespace std;
+
+namespace cpp20learning {
+	/* cpp20 - ranges
+	* Ranges are objects referring to a sequence of elements; similar to a .begin() .end() iterator pair
+	* They are a nice clean syntax to use 
+	* Any container that has a .begin() .end() are valid to use with ranges
+	* Almost all standard library algorithms accept range 
+	* Projection: transform elements of a container before being used by an algorithm
+	* View: transform/filter a range without ownership 
+	* Range factories: produce views on demand
+	* Pipelining: ranges are able to be created or changed in a row using pipes | 
+	* 
+	* This function explores much of the power and usability with ranges and views within ranges.
+	* Code is commented throughout the show processing 
+	*/
+	export void ranges_example() {
+		// pre c++20 
+		vector<int> somedata{ 45,7,2,22,100,64 };
+		sort(begin(somedata), end(somedata));
+
+		// c++20
+		vector<int> somedata2{ 5,23,76,23,8,22 };
+		ranges::sort(somedata2);
+
+		// piping views 
+		vector<int> somedata3{ 6,12,64,43,12,32,65,23 };
+		auto viewsResult{ somedata3
+			| views::transform([](const auto& x) { return x * 3; }) // multiply all vector elements by 3
+			| views::drop(2) // delete the first 2 elements of the container 
+			| views::reverse // reverse contents 
+			| views::transform([](const auto& x) { return to_string(x); }) // return contents as a string per element
+		};
+		// all of the view is lazy executed, so nothing is done unless you iterate over viewsResult
+
+		// show the view contents 
+		cout << "Views executed on vector returned: ";
+		auto jointView = ranges::join_view(viewsResult);
+		for (auto x : viewsResult) { cout << x << " "; }
+
+		//  values can also be filtered using a lambda func
+		const auto useValues = { 0,1,2,3,4,5,6,7,8,9,10 }; 
+		auto odd = [](const auto& x) { return x % 3 == 0; };  // lambda to determine odd numbers
+		cout << "\n\nDisplaying only odd values from a 0-10 using views and lambdas: ";
+		for (auto x : useValues | views::filter(odd)) { cout << x << " "; }
+
+		// values can be transformed and worked into one composed statment too
+		auto cubed = [](const auto& x) { return x * x * x; };	// returns a cubed version of the value 
+		cout << "\n\nDisplaying values that are odd and cubed from 0-10 using filter views: ";
+		for (auto x : views::transform(views::filter(useValues, odd), cubed)) { cout << x << " "; }
+
+	}
+
+	/* caching a view pipeline
+	* views are lazy and hold no results, so every pass over viewsResult above re-runs both transforms and
+	* the reverse .. fine once, wasted work when the same pipeline is walked over and over
+	*
+	* cached_views::cache_all (or its alias memoize) materialises the pipeline into a buffer on the first pass
+	* and every later pass just walks that buffer, which is contiguous so it pipes on like any vector
+	* the buffer comes from a pmr::memory_resource, hand it a pool to recycle storage between many cached views
+	*
+	* incremental mode: when the source changes, invalidate(i) marks element i in a dirty bitmap (or invalidate_all(), see below)
+	* and the next pass recomputes only the marked elements by indexing into the pipeline, which has to be random access
+	* an element is numbered by its position in the cached view, not in the source container
+	*
+	* copies of a cached view share one buffer, not thread safe .. same as iterating a vector while writing to it
+	*
+	* named cached_views and not views so it doesn't hide std::views inside this namespace
+	*/
+	export namespace cached_views {
+
+		template<ranges::view V>
+		class cache_all_view : public ranges::view_interface<cache_all_view<V>> {
+			using value_type = ranges::range_value_t<V>;
+
+			struct Cache {
+				V base;
+				pmr::vector<value_type> values;
+				vector<uint64_t> dirty;	// one bit per cached element
+				size_t dirtyCount{ 0 };
+				bool filled{ false };
+			};
+			shared_ptr<Cache> cache;
+
+			/* first pass materialises, later passes only redo what was invalidated */
+			void refresh() const {
+				if (!cache) { return; }	// default constructed, an empty view
+				auto& c{ *cache };
+				if (!c.filled) {
+					c.values.clear();
+					if constexpr (ranges::sized_range<V>) { c.values.reserve(ranges::size(c.base)); }
+					for (auto&& value : c.base) { c.values.emplace_back(forward<decltype(value)>(value)); }
+					c.dirty.assign((c.values.size() + 63) / 64, 0);
+					c.dirtyCount = 0;
+					c.filled = true;
+					return;
+				}
+				if constexpr (ranges::random_access_range<V>) {
+					if (c.dirtyCount == 0) { return; }
+					const auto first{ ranges::begin(c.base) };
+					for (size_t word{ 0 }; word < c.dirty.size(); ++word) {
+						for (auto bits{ exchange(c.dirty[word], 0) }; bits != 0; bits &= bits - 1) {	// clear the lowest set bit
+							const auto index{ word * 64 + countr_zero(bits) };
+							c.values[index] = first[static_cast<ranges::range_difference_t<V>>(index)];
+						}
+					}
+					c.dirtyCount = 0;
+				}
+			}
+
+		public:
+			cache_all_view() = default;
+			cache_all_view(V base, pmr::memory_resource* resource)
+				: cache{ make_shared<Cache>(std::move(base), pmr::vector<value_type>{ resource ? resource : pmr::get_default_resource() }) } {}
+
+			const value_type* begin() const { refresh(); return cache ? cache->values.data() : nullptr; }
+			const value_type* end() const { refresh(); return cache ? cache->values.data() + cache->values.size() : nullptr; }
+
+			/* the source of element index changed, recompute it on the next pass */
+			void invalidate(size_t index) requires ranges::random_access_range<V> {
+				if (!cache || !cache->filled || index >= cache->values.size()) { return; }	// nothing cached there yet
+				auto& c{ *cache };
+				const auto bit{ uint64_t{ 1 } << (index % 64) };
+				if (!(c.dirty[index / 64] & bit)) { c.dirty[index / 64] |= bit; ++c.dirtyCount; }
+			}
+
+			/* iterate base again on the next pass .. fine when the source only changed values in place, but views like
+			* filter, drop and reverse remember their begin() from the first pass, which is stale once the source
+			* changes shape (elements added/removed, a vector reallocated), hand in a freshly built pipeline for that */
+			void invalidate_all() { if (cache) { cache->filled = false; } }
+			void invalidate_all(V rebuilt) {
+				if (!cache) { return; }
+				cache->base = std::move(rebuilt);
+				cache->filled = false;
+			}
+		};
+
+		struct cache_all_fn {
+			pmr::memory_resource* resource{ nullptr };	// nullptr = the default resource
+
+			/* cached_views::cache_all(&pool) to allocate the buffer from a pool */
+			cache_all_fn operator()(pmr::memory_resource* pool) const { return { pool }; }
+
+			template<ranges::viewable_range R>
+			friend auto operator|(R&& range, cache_all_fn adaptor) {
+				return cache_all_view<views::all_t<R>>{ views::all(std::forward<R>(range)), adaptor.resource };
+			}
+		};
+
+		inline constexpr cache_all_fn cache_all{};
+		inline constexpr cache_all_fn memoize{};
+	}
+
+	export void cached_views_example() {
+		vector<int> somedata3{ 6,12,64,43,12,32,65,23 };
+		int conversions{ 0 };	// counts how often the expensive last step actually runs
+
+		pmr::unsynchronized_pool_resource pool;
+		auto cached{ somedata3
+			| views::transform([](const auto& x) { return x * 3; })
+			| views::drop(2)
+			| views::reverse
+			| views::transform([&conversions](const auto& x) { ++conversions; return to_string(x); })
+			| cached_views::cache_all(&pool)
+		};
+
+		cout << "\n\nCached views, three passes: ";
+		for (int pass{ 0 }; pass < 3; ++pass) {
+			for (const auto& x : cached) { cout << x << " "; }
+		}
+		cout << "\nto_string ran " << conversions << " times for 3 passes of " << cached.size() << " elements";
+
+		// the last source element is first after the reverse, so only cached element 0 needs redoing
+		somedata3.back() = 1000;
+		cached.invalidate(0);
+		cout << "\nAfter changing one source value: ";
+		for (const auto& x : cached) { cout << x << " "; }
+		cout << "\nto_string ran " << conversions << " times in total\n";
+	}
+
+	/* ranges over memory mapped files
+	* the views above only ever see small vectors, but any contiguous bytes work as a range source
+	* mmap() maps a whole file into the address space, the kernel pages it in as it's touched
+	*	no read() copies into a buffer, the span/string_view point straight at the page cache
+	*	madvise(MADV_SEQUENTIAL) tells the kernel to read ahead aggressively and drop pages behind us
+	* record_views::lines and record_views::split_records(delim) are view adaptors yielding string_views into the mapping,
+	* so the same filter/transform pipelines from ranges_example() run over a multi-GB log with zero copies
+	*
+	* files bigger than we want mapped at once go through stream_records(), a coroutine that maps
+	* one window at a time and yields each record .. a record split across two windows is stitched together in a carry string
+	*
+	* POSIX only, checked the same way as <optional> in test_macros()
+	*/
+
+	#if has_mapped_file
+
+	/* owns an open descriptor for the length of a scope, mappings keep their own reference to the file */
+	export struct FileDescriptor {
+		int fd;
+
+		explicit FileDescriptor(const char* path) : fd{ open(path, O_RDONLY | O_CLOEXEC) } {
+			if (fd < 0) { throw system_error(errno, generic_category(), path); }
+		}
+		FileDescriptor(const FileDescriptor&) = delete;
+		FileDescriptor& operator=(const FileDescriptor&) = delete;
+		~FileDescriptor() { close(fd); }
+
+		size_t size() const {
+			struct stat info {};
+			if (fstat(fd, &info) != 0) { throw system_error(errno, generic_category(), "fstat"); }
+			return static_cast<size_t>(info.st_size);
+		}
+	};
+
+	export class MappedFile {
+		void* address{ nullptr };
+		size_t length{ 0 };
+
+	public:
+		/* map one window of an open file, offset must be a multiple of the page size */
+		MappedFile(const FileDescriptor& file, off_t offset, size_t bytes) : length{ bytes } {
+			if (length == 0) { return; } // mmap() refuses zero length, an empty file is just an empty span
+
+			address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, file.fd, offset);
+			if (address == MAP_FAILED) {
+				address = nullptr;
+				throw system_error(errno, generic_category(), "mmap");
+			}
+			madvise(address, length, MADV_SEQUENTIAL);
+		}
+
+		/* map the whole file */
+		explicit MappedFile(const FileDescriptor& file) : MappedFile{ file, 0, file.size() } {}
+		explicit MappedFile(const char* path) : MappedFile{ FileDescriptor{ path } } {}
+
+		MappedFile(MappedFile&& other) noexcept
+			: address{ exchange(other.address, nullptr) }, length{ exchange(other.length, 0) } {}
+
+		MappedFile& operator=(MappedFile&& other) noexcept {
+			swap(address, other.address);
+			swap(length, other.length);
+			return *this;
+		}
+
+		~MappedFile() { if (address) { munmap(address, length); } }
+
+		span<const byte> bytes() const { return { static_cast<const byte*>(address), length }; }
+		string_view text() const { return { static_cast<const char*>(address), length }; }
+	};
+
+	export namespace record_views {
+
+		/* forward view of the delimited records in a string_view, the final record doesn't need a trailing delimiter */
+		class split_records_view : public ranges::view_interface<split_records_view> {
+			string_view text;
+			char delimiter{ '\n' };
+
+		public:
+			class iterator {
+				string_view rest;
+				string_view current;
+				char delimiter{ '\n' };
+				bool done{ true };
+
+				void next() {
+					if (rest.empty()) { done = true; return; }
+					const auto end{ rest.find(delimiter) };
+					current = rest.substr(0, end);
+					rest.remove_prefix(end == string_view::npos ? rest.size() : end + 1);
+				}
+
+			public:
+				using value_type = string_view;
+				using difference_type = ptrdiff_t;
+
+				iterator() = default;
+				iterator(string_view text, char delimiter) : rest{ text }, delimiter{ delimiter }, done{ false } { next(); }
+
+				string_view operator*() const { return current; }
+				iterator& operator++() { next(); return *this; }
+				iterator operator++(int) { auto old{ *this }; next(); return old; }
+
+				bool operator==(const iterator& other) const {
+					return done == other.done && (done || current.data() == other.current.data());
+				}
+				bool operator==(default_sentinel_t) const { return done; }
+			};
+
+			split_records_view() = default;
+			split_records_view(string_view text, char delimiter) : text{ text }, delimiter{ delimiter } {}
+
+			iterator begin() const { return { text, delimiter }; }
+			default_sentinel_t end() const { return {}; }
+		};
+
+		struct split_records {
+			char delimiter;
+
+			friend split_records_view operator|(string_view text, split_records adaptor) {
+				return { text, adaptor.delimiter };
+			}
+			friend split_records_view operator|(span<const byte> bytes, split_records adaptor) {
+				return { string_view{ reinterpret_cast<const char*>(bytes.data()), bytes.size() }, adaptor.delimiter };
+			}
+			// a temporary string would convert to string_view and be gone before the records are read
+			friend split_records_view operator|(const string&&, split_records) = delete;
+		};
+
+		inline constexpr split_records lines{ '\n' };
+	}
+
+	/* window by window coroutine for files larger than the address space budget
+	* the yielded string_view is only valid until the generator is resumed */
+	export generator<string_view> stream_records(const char* path, char delimiter = '\n', size_t windowBytes = 64 << 20) {
+		const FileDescriptor file{ path };
+		const auto fileSize{ file.size() };
+
+		// windows have to start on a page boundary
+		const auto pageSize{ static_cast<size_t>(sysconf(_SC_PAGESIZE)) };
+		windowBytes = max(pageSize, (windowBytes + pageSize - 1) / pageSize * pageSize);
+
+		string carry;	// a record that started in the previous window
+		for (size_t offset{ 0 }; offset < fileSize; offset += windowBytes) {
+			const MappedFile window{ file, static_cast<off_t>(offset), min(windowBytes, fileSize - offset) };
+			auto text{ window.text() };
+
+			if (!carry.empty()) {
+				const auto end{ text.find(delimiter) };
+				if (end == string_view::npos) { carry.append(text); continue; }
+
+				carry.append(text.substr(0, end));
+				co_yield carry;
+				carry.clear();
+				text.remove_prefix(end + 1);
+			}
+
+			for (auto end{ text.find(delimiter) }; end != string_view::npos; end = text.find(delimiter)) {
+				co_yield text.substr(0, end);
+				text.remove_prefix(end + 1);
+			}
+			carry.assign(text);
+		}
+
+		if (!carry.empty()) { co_yield carry; }
+	}
+	#endif
+
+	export void mapped_file_example() {
+	#if has_mapped_file
+		// this very source file makes a handy "log" to run a pipeline over
+		const auto path{ source_location::current().file_name() };
+
+		try {
+			const MappedFile file{ path };
+
+			auto cpp20Lines{ file.bytes()
+				| record_views::lines
+				| views::filter([](string_view line) { return line.find("cpp20") != string_view::npos; })
+				| views::transform([](string_view line) { return line.size(); })
+			};
+
+			size_t count{ 0 }, totalBytes{ 0 };
+			for (const auto bytes : cpp20Lines) { ++count; totalBytes += bytes; }
+			cout << "\n\nMapped " << file.bytes().size() << " bytes of " << path << ", " << count
+				<< " lines mention cpp20 (" << totalBytes << " bytes)\n";
+		}
+		catch (const system_error& error) {
+			cout << "\n\nCould not map " << path << ": " << error.what() << endl;
+		}
+	#endif
+	}
+}
@@ -0,0 +1,375 @@
+/* tests.cpp
+* 2022-06-21
+* Collin Abraham
+*
+* Checks for the reusable pieces of the cpp20learning module (the examples themselves just print)
+* Each check prints what failed and the program returns non-zero if anything did, so ctest picks it up
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <source_location>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+import cpp20learning;
+
+using namespace std;
+using namespace cpp20learning;
+
+int failures{ 0 };
+
+void check(bool passed, const source_location location = source_location::current()) {
+	if (!passed) {
+		cout << "check failed at line " << location.line() << " in " << location.function_name() << '\n';
+		++failures;
+	}
+}
+
+void radix_sort_matches_spaceship() {
+	struct Record {
+		double weight;
+		short group;
+		long long id;
+
+		auto operator<=>(const Record&) const = default;
+		auto sort_members() const { return tie(weight, group, id); }
+	};
+
+	vector<Record> records;
+	for (int i{ 0 }; i < 20'000; ++i) {
+		records.push_back({ (i % 37) - 18.5, static_cast<short>(i % 11 - 5), (i * 7919LL) % 10007 - 5000 });
+	}
+	auto expected{ records };
+	ranges::sort(expected);
+
+	radix_sort(records);
+	check(records == expected);
+
+	// keys that pack into one integer: mixed widths and signs, plus a payload outside the key to check stability
+	struct Narrow {
+		signed char level;
+		bool flag;
+		short delta;
+		int original;
+
+		auto sort_members() const { return tie(level, flag, delta); }
+		auto operator<=>(const Narrow& other) const { return sort_members() <=> other.sort_members(); }
+		bool operator==(const Narrow&) const = default;
+	};
+	vector<Narrow> narrow;
+	for (int i{ 0 }; i < 20'000; ++i) {
+		narrow.push_back({ static_cast<signed char>((i * 37) % 256 - 128), i % 3 == 0, static_cast<short>((i * 7919) % 61 - 30), i });
+	}
+	auto expectedNarrow{ narrow };
+	ranges::stable_sort(expectedNarrow);
+	radix_sort(narrow);
+	check(narrow == expectedNarrow);
+
+	// under 256 records takes the comparison fallback, which has to be just as stable
+	for (const auto size : { 100, 255, 256 }) {
+		vector<Narrow> few;
+		for (int i{ 0 }; i < size; ++i) { few.push_back({ static_cast<signed char>(i % 3), false, 0, i }); }
+		auto expectedFew{ few };
+		ranges::stable_sort(expectedFew);
+		radix_sort(few);
+		check(few == expectedFew);
+	}
+
+	struct Pair {
+		int group;
+		unsigned id;
+		int original;
+
+		auto sort_members() const { return tie(group, id); }
+		auto operator<=>(const Pair& other) const { return sort_members() <=> other.sort_members(); }
+		bool operator==(const Pair&) const = default;
+	};
+	vector<Pair> pairs;
+	for (int i{ 0 }; i < 20'000; ++i) {
+		pairs.push_back({ (i % 2 ? -1 : 1) * static_cast<int>((i * 2654435761u) % 100'000), static_cast<unsigned>((i * 40503u) % 7), i });
+	}
+	auto expectedPairs{ pairs };
+	ranges::stable_sort(expectedPairs);
+	radix_sort(pairs);
+	check(pairs == expectedPairs);
+
+	// one member that spans all 64 bits: a single key with no room left for the index
+	struct Full {
+		unsigned long long value;
+		int original;
+
+		auto sort_members() const { return tie(value); }
+		auto operator<=>(const Full& other) const { return sort_members() <=> other.sort_members(); }
+		bool operator==(const Full&) const = default;
+	};
+	vector<Full> full;
+	for (int i{ 0 }; i < 5'000; ++i) { full.push_back({ i % 5 == 0 ? ~0ull - i % 7 : (i * 0x9E3779B97F4A7C15ull) % 9, i }); }
+	auto expectedFull{ full };
+	ranges::stable_sort(expectedFull);
+	radix_sort(full);
+	check(full == expectedFull);
+
+	vector<CompareClass> compared;
+	for (int i{ 0 }; i < 1'000; ++i) { compared.emplace_back(500 - i); }
+	radix_sort(compared);
+	check(ranges::is_sorted(compared));
+}
+
+template<typename TEXT>
+concept splittable = requires(TEXT&& text) { std::forward<TEXT>(text) | record_views::lines; };
+
+void record_views_split_lines() {
+	static_assert(splittable<string&> && splittable<string_view>);
+	static_assert(!splittable<string> && !splittable<const string>);	// the views would dangle
+
+	vector<string_view> lines;
+	for (const auto line : string_view{ "first\n\nthird\nlast" } | record_views::lines) { lines.push_back(line); }
+	check(lines == vector<string_view>{ "first", "", "third", "last" });
+
+	vector<string_view> fields;
+	for (const auto field : string_view{ "a,b,c," } | record_views::split_records{ ',' }) { fields.push_back(field); }
+	check(fields == vector<string_view>{ "a", "b", "c" });
+}
+
+void stream_records_matches_mapping() {
+	const string path{ "cpp20learning_tests_records.txt" };
+	if (auto* file{ fopen(path.c_str(), "w") }) {
+		for (int i{ 0 }; i < 5'000; ++i) { fprintf(file, "%s\n", string(i % 97, static_cast<char>('a' + i % 26)).c_str()); }
+		fputs("no trailing newline", file);
+		fclose(file);
+	}
+
+	vector<string> mapped, streamed;
+	const MappedFile file{ path.c_str() };
+	for (const auto line : file.text() | record_views::lines) { mapped.emplace_back(line); }
+	for (const auto line : stream_records(path.c_str(), '\n', 4096)) { streamed.emplace_back(line); }	// lots of window boundaries
+	remove(path.c_str());
+
+	check(mapped.size() == 5'001);
+	check(mapped == streamed);
+}
+
+void task_inline_and_spilled() {
+	task<int()> small{ [value = make_unique<int>(41)] { return *value + 1; } };
+	check(small() == 42 && !small.allocated());
+
+	pmr::unsynchronized_pool_resource pool;
+	array<int, 64> lookup{};
+	lookup[63] = 7;
+	task<int(size_t)> big{ [lookup](size_t i) { return lookup[i]; }, &pool };
+	check(big.allocated());
+
+	auto moved{ move(big) };
+	check(!big && moved(63) == 7);
+}
+
+void pipeline_runs_every_stage() {
+	ThreadPool pool{ 3 };
+	Pipeline pipeline{ pool };
+	auto& numbers{ pipeline.channel<int>(8) };
+	auto& squares{ pipeline.channel<long long>(8) };
+
+	long long sum{ 0 };
+	pipeline.source("numbers", views::iota(1, 1'001), numbers);
+	pipeline.transform("square", numbers, squares, [](int x) { return 1LL * x * x; });
+	pipeline.sink("sum", squares, [&sum](long long x) { sum += x; });
+	pipeline.run();
+
+	check(sum == 1000LL * 1001 * 2001 / 6);
+	check(pipeline.stats().back().items == 1'000);
+}
+
+void pipeline_backpressure_holds_the_source_back() {
+	ThreadPool pool{ 2 };
+	Pipeline pipeline{ pool };
+	auto& numbers{ pipeline.channel<int>(1) };
+
+	atomic<int> produced{ 0 };
+	int consumed{ 0 }, mostAhead{ 0 };
+	bool inOrder{ true };
+	pipeline.source("numbers", views::iota(0, 200) | views::transform([&produced](int x) { ++produced; return x; }), numbers);
+	pipeline.sink("slow", numbers, [&](int x) {
+		mostAhead = max(mostAhead, produced.load() - consumed);
+		inOrder = inOrder && x == consumed;
+		this_thread::sleep_for(50us);
+		++consumed;
+	});
+	pipeline.run();
+
+	// one item in the sink, one in the buffer, one waiting in the source's send .. never more
+	check(consumed == 200 && inOrder);
+	check(mostAhead <= 3);
+}
+
+void pipeline_filter_can_drop_everything() {
+	ThreadPool pool{ 2 };
+	Pipeline pipeline{ pool };
+	auto& numbers{ pipeline.channel<int>(4) };
+	auto& kept{ pipeline.channel<int>(4) };
+
+	int sunk{ 0 };
+	pipeline.source("numbers", views::iota(0, 1'000), numbers);
+	pipeline.filter("nothing", numbers, kept, [](int) { return false; });
+	pipeline.sink("count", kept, [&sunk](int) { ++sunk; });
+	pipeline.run();
+
+	check(sunk == 0);
+	check(pipeline.stats()[1].items == 1'000 && pipeline.stats()[2].items == 0);
+}
+
+void pipeline_stage_error_winds_down_and_rethrows() {
+	ThreadPool pool{ 3 };
+	Pipeline pipeline{ pool };
+	auto& numbers{ pipeline.channel<int>(1) };
+	auto& doubled{ pipeline.channel<int>(1) };
+
+	pipeline.source("numbers", views::iota(0), numbers);	// endless, only the error can stop it
+	pipeline.transform("double", numbers, doubled, [](int x) {
+		if (x == 500) { throw runtime_error{ "bad record" }; }
+		return x * 2;
+	});
+	pipeline.sink("drop", doubled, [](int) {});
+
+	bool rethrown{ false };
+	try { pipeline.run(); }
+	catch (const runtime_error& error) { rethrown = string_view{ error.what() } == "bad record"; }
+	check(rethrown);
+	check(pipeline.stats()[1].items == 500);
+}
+
+void enum_round_trip() {
+	for (const auto season : enum_values<Seasons>) { check(from_string<Seasons>(to_string(season)) == season); }
+	check(enum_values<Seasons>.size() == 4);
+	check(!from_string<Seasons>("Monsoon"));
+}
+
+void interner_hands_out_one_handle_per_string() {
+	StringInterner names;
+	const auto bob{ names.intern(string{ "bob" }) };
+	check(bob == *names.find("bob"));
+	check(bob && bob.id <= seededNames.size());
+
+	// the default handle is nobody's name
+	check(!InternedString{} && InternedString{} != names.intern(seededNames[0]));
+	check(names.view(InternedString{}).empty());
+	const auto empty{ names.intern("") };
+	check(empty && empty == names.intern("") && names.view(empty).empty());
+
+	const auto fresh{ names.intern("not seeded") };
+	check(fresh == names.intern("not seeded") && fresh != bob);
+	check(names.view(fresh) == "not seeded");
+	check(!names.find("never interned"));
+
+	// enough names to spill over several of the doubling segments
+	vector<InternedString> handles;
+	for (int i{ 0 }; i < 5'000; ++i) { handles.push_back(names.intern("name " + to_string(i))); }
+	bool allViewed{ true };
+	for (int i{ 0 }; i < 5'000; ++i) { allViewed = allViewed && names.view(handles[i]) == "name " + to_string(i); }
+	check(allViewed);
+
+	// seeds built at runtime are copied, the interner doesn't keep views into them
+	vector<string> owned{ "alpha", "beta" };
+	StringInterner runtimeSeeded{ vector<string_view>(owned.begin(), owned.end()) };
+	owned.assign(2, "overwritten");	// reuses the storage the seeds pointed at
+	check(runtimeSeeded.size() == 2 && runtimeSeeded.view(*runtimeSeeded.find("beta")) == "beta");
+}
+
+void cached_view_runs_pipeline_once() {
+	vector<int> source;
+	for (int i{ 0 }; i < 200; ++i) { source.push_back(i); }
+	int calls{ 0 };
+	const auto doubled{ [&calls](int x) { ++calls; return x * 2; } };
+	auto cached{ source | views::reverse | views::transform(doubled) | cached_views::memoize };
+	check(calls == 0);	// still lazy until the first pass
+
+	for (int pass{ 0 }; pass < 3; ++pass) { check(ranges::equal(cached, source | views::reverse | views::transform([](int x) { return x * 2; }))); }
+	check(calls == 200);
+
+	source[0] = 1000;	// last element after the reverse
+	source[150] = -1;
+	cached.invalidate(199);
+	cached.invalidate(49);
+	cached.invalidate(49);	// marking twice still recomputes once
+	check(cached[199] == 2000 && cached[49] == -2 && calls == 202);
+
+	source.push_back(7);	// shape changed (and maybe reallocated), so rebuild the pipeline and run all of it again
+	cached.invalidate_all(source | views::reverse | views::transform(doubled));
+	check(cached.size() == 201 && cached.front() == 14 && calls == 403);
+
+	auto evens{ cached | views::filter([](int x) { return x % 4 == 0; }) };	// still pipes on like any other range
+	check(ranges::distance(evens) == 99 && calls == 403);
+
+	decltype(cached) empty;	// default constructed views are empty, not null
+	empty.invalidate(0);
+	empty.invalidate_all();
+	check(empty.empty() && ranges::distance(empty) == 0);
+}
+
+void hash_kernels_match_naive_versions() {
+	vector<int> values;
+	for (int i{ 0 }; i < 50'000; ++i) { values.push_back((i * 7919) % 3'001); }	// every value repeats ~16 times, scattered
+
+	vector<int> expectedUnique;
+	for (const auto value : values) {
+		if (ranges::find(expectedUnique, value) == expectedUnique.end()) { expectedUnique.push_back(value); }
+	}
+	auto unique{ values };
+	check(unique_by_hash(unique) == values.size() - expectedUnique.size());
+	check(unique == expectedUnique);	// first occurrences, original order
+
+	const vector<int> toRemove{ 0, 1'024, 2'048, 3'000, 5'000 };	// 5'000 never appears
+	auto pruned{ values };
+	auto expectedPruned{ values };
+	const auto expectedCount{ erase_if(expectedPruned, [&toRemove](int x) { return ranges::find(toRemove, x) != toRemove.end(); }) };
+	check(erase_values(pruned, toRemove) == expectedCount);
+	check(pruned == expectedPruned);
+
+	vector<string> names{ "bob", "Billy", "bob", "Jimmy", "Billy", "sally" };
+	check(unique_by_hash(names) == 2 && names == vector<string>{ "bob", "Billy", "Jimmy", "sally" });
+	check(erase_values(names, array{ string{ "Jimmy" } }) == 1 && names.size() == 3);
+	check(compact_erase_if(names, [](const string& name) { return name.starts_with('b'); }) == 1 && names.back() == "sally");
+
+	FlatHashSet<long long> set;
+	for (long long i{ 0 }; i < 10'000; ++i) { set.insert(i << 20); }	// all the same low bits
+	check(set.size() == 10'000 && set.contains(9'999LL << 20) && !set.contains(1) && !set.insert(0));
+
+	// no default constructor, the set only builds the values it's given
+	struct Tag {
+		explicit Tag(int value) : value{ value } {}
+		int value;
+		bool operator==(const Tag&) const = default;
+	};
+	const auto tagHash{ [](const Tag& tag) { return hash<int>{}(tag.value); } };
+	FlatHashSet<Tag, decltype(tagHash)> tags{ 0, tagHash };
+	for (int i{ 0 }; i < 100; ++i) { tags.insert(Tag{ i % 40 }); }
+	check(tags.size() == 40 && tags.contains(Tag{ 39 }) && !tags.contains(Tag{ 40 }));
+}
+
+int main() {
+	radix_sort_matches_spaceship();
+	record_views_split_lines();
+	cached_view_runs_pipeline_once();
+	stream_records_matches_mapping();
+	task_inline_and_spilled();
+	pipeline_runs_every_stage();
+	pipeline_backpressure_holds_the_source_back();
+	pipeline_filter_can_drop_everything();
+	pipeline_stage_error_winds_down_and_rethrows();
+	enum_round_trip();
+	interner_hands_out_one_handle_per_string();
+	hash_kernels_match_naive_versions();
+
+	cout << (failures == 0 ? "all checks passed\n" : "some checks failed\n");
+	return failures == 0 ? 0 : 1;
+}
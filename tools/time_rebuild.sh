@@ -0,0 +1,31 @@
+#!/bin/sh
+# time_rebuild.sh
+#
+# Do module imports really cut rebuild times? This times three builds of the CMake tree:
+#	a clean build of everything
+#	a rebuild after touching main.cpp, only the importer recompiles .. the module's BMIs are reused as is
+#	a rebuild after touching one partition, that partition, the primary interface and every importer recompile
+#
+# usage: tools/time_rebuild.sh [build directory]   (needs Ninja, see CMakeLists.txt)
+
+set -e
+source_dir=$(cd "$(dirname "$0")/.." && pwd)
+build_dir=${1:-"$source_dir/_rebuild_timing"}
+
+timed_build() {
+	start=$(date +%s%N)
+	cmake --build "$build_dir" > /dev/null
+	end=$(date +%s%N)
+	echo "$1: $(( (end - start) / 1000000 )) ms"
+}
+
+rm -rf "$build_dir"
+cmake -S "$source_dir" -B "$build_dir" -G Ninja -DCMAKE_BUILD_TYPE=Release > /dev/null
+
+timed_build "clean build"
+
+touch "$source_dir/main.cpp"
+timed_build "rebuild after touching main.cpp"
+
+touch "$source_dir/modules/bit.cppm"
+timed_build "rebuild after touching modules/bit.cppm"